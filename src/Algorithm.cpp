@@ -23,7 +23,10 @@ using namespace std;
 Algorithm::Algorithm(std::string const &name)
  : m_sName(name)
  , m_bQuiet(false)
+ , m_pSearchLimits(nullptr)
+ , m_pSearchStatistics(nullptr)
  , m_vCallBacks()
+ , m_TimeOfLargestClique()
 {
 }
 
@@ -43,6 +46,16 @@ void Algorithm::ExecuteCallBacks(std::list<int> const &vertexSet) const
     }
 }
 
+chrono::steady_clock::time_point Algorithm::GetTimeOfLargestClique() const
+{
+    return m_TimeOfLargestClique;
+}
+
+void Algorithm::RecordTimeOfLargestClique()
+{
+    m_TimeOfLargestClique = chrono::steady_clock::now();
+}
+
 void Algorithm::SetName(string const &name)
 {
     m_sName = name;
@@ -62,3 +75,23 @@ bool Algorithm::GetQuiet() const
 {
     return m_bQuiet;
 }
+
+void Algorithm::SetSearchLimits(SearchLimits *pLimits)
+{
+    m_pSearchLimits = pLimits;
+}
+
+SearchLimits *Algorithm::GetSearchLimits() const
+{
+    return m_pSearchLimits;
+}
+
+void Algorithm::SetSearchStatistics(SearchStatistics *pStatistics)
+{
+    m_pSearchStatistics = pStatistics;
+}
+
+SearchStatistics *Algorithm::GetSearchStatistics() const
+{
+    return m_pSearchStatistics;
+}
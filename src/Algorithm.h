@@ -21,6 +21,10 @@
 #include <list>
 #include <string>
 #include <functional>
+#include <chrono>
+
+class SearchLimits;
+class SearchStatistics;
 
 class Algorithm
 {
@@ -41,10 +45,37 @@ public:
     void SetQuiet(bool const quiet);
     bool GetQuiet() const;
 
+    // when a limit is reached, Run returns with the largest clique found so far.
+    void SetSearchLimits(SearchLimits *pLimits);
+    SearchLimits *GetSearchLimits() const;
+
+    // if set, Run adds the counters of its search tree to pStatistics.
+    void SetSearchStatistics(SearchStatistics *pStatistics);
+    SearchStatistics *GetSearchStatistics() const;
+
+    // an upper bound on the size of a maximum clique, the size of the
+    // largest clique found if the search finished.
+    virtual size_t GetUpperBound() const = 0;
+
+    virtual size_t GetNodeCount() const = 0;
+
+    // processor time from the start of the algorithm to the largest clique found.
+    virtual double GetTimeToLargestCliqueInSeconds() const = 0;
+
+    // when the largest clique was found, on the clock that times Run; the
+    // clock's epoch if no clique was found.
+    virtual std::chrono::steady_clock::time_point GetTimeOfLargestClique() const;
+
+protected:
+    void RecordTimeOfLargestClique();
+
 private:
     std::string m_sName;
     bool m_bQuiet;
+    SearchLimits *m_pSearchLimits;
+    SearchStatistics *m_pSearchStatistics;
     std::vector<std::function<void(std::list<int> const&)>> m_vCallBacks;
+    std::chrono::steady_clock::time_point m_TimeOfLargestClique;
 };
 
 #endif //ALGORITHM_H
@@ -0,0 +1,117 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef BIT_SET_H
+#define BIT_SET_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// A fixed-size set of integers in [0,size), packed 64 per word, so that
+// intersections and differences are done a word at a time.
+class BitSet
+{
+public:
+    BitSet(size_t const size) : m_Words(NumWordsFor(size), 0), m_uSize(size)
+    {
+    }
+
+    BitSet() : m_Words(), m_uSize(0)
+    {
+    }
+
+    ~BitSet() {}
+
+    static size_t NumWordsFor(size_t const size) { return (size + 63) >> 6; }
+    static int    LowestBit(uint64_t const word) { return __builtin_ctzll(word); }
+    static int    PopCount(uint64_t const word)  { return __builtin_popcountll(word); }
+
+    void Resize(size_t const size)
+    {
+        m_Words.resize(NumWordsFor(size), 0);
+        m_uSize = size;
+    }
+
+    bool Contains(int const x) const { return (m_Words[x >> 6] >> (x & 63)) & 1; }
+    void Insert(int const x)         { m_Words[x >> 6] |=  (static_cast<uint64_t>(1) << (x & 63)); }
+    void Remove(int const x)         { m_Words[x >> 6] &= ~(static_cast<uint64_t>(1) << (x & 63)); }
+
+    void Clear()
+    {
+        for (uint64_t &word : m_Words) word = 0;
+    }
+
+    bool Empty() const
+    {
+        for (uint64_t const word : m_Words) {
+            if (word != 0) return false;
+        }
+        return true;
+    }
+
+    size_t Size() const
+    {
+        size_t count(0);
+        for (uint64_t const word : m_Words) {
+            count += PopCount(word);
+        }
+        return count;
+    }
+
+    // this = first & second
+    void Intersect(BitSet const &first, BitSet const &second)
+    {
+        size_t const numWords(m_Words.size());
+        uint64_t       *pWords(m_Words.data());
+        uint64_t const *pFirst(first.m_Words.data());
+        uint64_t const *pSecond(second.m_Words.data());
+        for (size_t index = 0; index < numWords; ++index) {
+            pWords[index] = pFirst[index] & pSecond[index];
+        }
+    }
+
+    // this = this \ other
+    void RemoveAll(BitSet const &other)
+    {
+        size_t const numWords(m_Words.size());
+        uint64_t       *pWords(m_Words.data());
+        uint64_t const *pOther(other.m_Words.data());
+        for (size_t index = 0; index < numWords; ++index) {
+            pWords[index] &= ~pOther[index];
+        }
+    }
+
+    size_t          NumWords() const { return m_Words.size(); }
+    size_t          Capacity() const { return m_uSize; }
+    uint64_t       *Words()          { return m_Words.data(); }
+    uint64_t const *Words()    const { return m_Words.data(); }
+
+    void PrintSummary() const
+    {
+        std::cout << "BitSet[" << m_uSize << "] : ";
+        for (size_t index = 0; index < m_uSize; ++index) {
+            if (Contains(index)) std::cout << index << " ";
+        }
+        std::cout << std::endl;
+    }
+
+private:
+    std::vector<uint64_t> m_Words;
+    size_t m_uSize;
+};
+
+#endif // BIT_SET_H
@@ -0,0 +1,263 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "BitSetCliqueColoringStrategy.h"
+#include "PerfCounters.h"
+
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+using namespace std;
+
+BitSetCliqueColoringStrategy::BitSetCliqueColoringStrategy(vector<vector<char>> const &adjacencyMatrix)
+ : ColoringStrategy()
+ , m_AdjacencyMatrix(adjacencyMatrix)
+ , m_vNeighbors()
+ , m_vRank(adjacencyMatrix.size(), -1)
+ , m_vVertex(adjacencyMatrix.size(), -1)
+ , m_vColorClasses()
+ , m_vVerticesAboveThreshold()
+ , m_vColorsAboveThreshold()
+ , m_Uncolored(adjacencyMatrix.size())
+ , m_ColorClass(adjacencyMatrix.size())
+ , m_uFirstWord(0)
+ , m_uLastWord(0)
+{
+    vector<int> vIdentity(adjacencyMatrix.size());
+    for (size_t vertex = 0; vertex < adjacencyMatrix.size(); ++vertex) {
+        vIdentity[vertex] = vertex;
+    }
+    SetVertexOrder(vIdentity);
+
+    m_vVerticesAboveThreshold.reserve(adjacencyMatrix.size());
+    m_vColorsAboveThreshold.reserve(adjacencyMatrix.size());
+}
+
+void BitSetCliqueColoringStrategy::SetVertexOrder(vector<int> const &vVertexOrder)
+{
+    size_t const size(m_AdjacencyMatrix.size());
+    for (size_t rank = 0; rank < vVertexOrder.size(); ++rank) {
+        m_vVertex[rank] = vVertexOrder[rank];
+        m_vRank[vVertexOrder[rank]] = rank;
+    }
+
+    m_vNeighbors.assign(size, BitSet(size));
+    for (size_t vertex = 0; vertex < size; ++vertex) {
+        BitSet &neighbors(m_vNeighbors[m_vRank[vertex]]);
+        for (size_t neighbor = 0; neighbor < size; ++neighbor) {
+            if (m_AdjacencyMatrix[vertex][neighbor]) neighbors.Insert(m_vRank[neighbor]);
+        }
+    }
+}
+
+void BitSetCliqueColoringStrategy::InitializeUncolored(vector<int> const &vVertexOrder)
+{
+    m_Uncolored.Clear();
+    m_uFirstWord = m_Uncolored.NumWords();
+    m_uLastWord  = 0;
+    for (int const vertex : vVertexOrder) {
+        int const rank(m_vRank[vertex]);
+        m_Uncolored.Insert(rank);
+        m_uFirstWord = min(m_uFirstWord, static_cast<size_t>(rank >> 6));
+        m_uLastWord  = max(m_uLastWord,  static_cast<size_t>(rank >> 6));
+    }
+}
+
+void BitSetCliqueColoringStrategy::Color(vector<vector<char>> const &adjacencyMatrix, vector<int> const &vVertexOrder, vector<int> &vVerticesToReorder, vector<int> &vColors)
+{
+    if (vVertexOrder.empty()) return;
+
+    InitializeUncolored(vVertexOrder);
+
+    uint64_t *pUncolored(m_Uncolored.Words());
+    uint64_t *pColorClass(m_ColorClass.Words());
+
+    size_t uNumUncolored(vVertexOrder.size());
+    size_t uFirstWord(m_uFirstWord);
+    size_t currentIndex(0);
+    int color(0);
+
+    while (uNumUncolored > 0) {
+        color++;
+        while (pUncolored[uFirstWord] == 0) uFirstWord++;
+
+        for (size_t word = uFirstWord; word <= m_uLastWord; ++word) {
+            pColorClass[word] = pUncolored[word];
+        }
+
+        for (size_t word = uFirstWord; word <= m_uLastWord; ++word) {
+            while (pColorClass[word] != 0) {
+                int const bit(BitSet::LowestBit(pColorClass[word]));
+                int const rank((word << 6) + bit);
+                uint64_t const mask(~(static_cast<uint64_t>(1) << bit));
+                pColorClass[word] &= mask;
+                pUncolored[word]  &= mask;
+                uNumUncolored--;
+
+                uint64_t const *pNeighbors(m_vNeighbors[rank].Words());
+                for (size_t otherWord = word; otherWord <= m_uLastWord; ++otherWord) {
+                    pColorClass[otherWord] &= ~pNeighbors[otherWord];
+                }
+
+                vVerticesToReorder[currentIndex] = m_vVertex[rank];
+                vColors[currentIndex] = color;
+                currentIndex++;
+            }
+        }
+    }
+}
+
+// Same as Color, but classes up to the threshold (m_uMaximumCliqueSize -
+// R.size()) are kept as bitsets, and each vertex that would get a color above
+// the threshold first tries to be repaired into one of them (Re-NUMBER).
+void BitSetCliqueColoringStrategy::Recolor(vector<vector<char>> const &adjacencyMatrix, vector<int> const &vVertexOrder, vector<int> &vVerticesToReorder, vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize)
+{
+    if (vVertexOrder.empty()) return;
+
+    int const iBestCliqueDelta(currentBestCliqueSize - currentCliqueSize);
+    int const iNumStoredClasses(max(iBestCliqueDelta, 0));
+
+    InitializeUncolored(vVertexOrder);
+
+    if (static_cast<int>(m_vColorClasses.size()) < iNumStoredClasses) {
+        m_vColorClasses.resize(iNumStoredClasses, BitSet(m_AdjacencyMatrix.size()));
+    }
+
+    m_vVerticesAboveThreshold.clear();
+    m_vColorsAboveThreshold.clear();
+
+    uint64_t *pUncolored(m_Uncolored.Words());
+    uint64_t *pColorClass(m_ColorClass.Words());
+
+    size_t uNumUncolored(vVertexOrder.size());
+    size_t uFirstWord(m_uFirstWord);
+    int color(0);
+    int iNumStoredClassesUsed(0);
+
+    while (uNumUncolored > 0) {
+        bool const bStoredClass(color < iNumStoredClasses);
+        bool bClassIsEmpty(true);
+        color++;
+        while (pUncolored[uFirstWord] == 0) uFirstWord++;
+
+        for (size_t word = uFirstWord; word <= m_uLastWord; ++word) {
+            pColorClass[word] = pUncolored[word];
+        }
+
+        if (bStoredClass) {
+            m_vColorClasses[color-1].Clear();
+            iNumStoredClassesUsed = color;
+        }
+
+        for (size_t word = uFirstWord; word <= m_uLastWord; ++word) {
+            while (pColorClass[word] != 0) {
+                int const bit(BitSet::LowestBit(pColorClass[word]));
+                int const rank((word << 6) + bit);
+                uint64_t const mask(~(static_cast<uint64_t>(1) << bit));
+                pColorClass[word] &= mask;
+                pUncolored[word]  &= mask;
+                uNumUncolored--;
+
+                if (color > iBestCliqueDelta && Repair(rank, iBestCliqueDelta)) {
+                    continue;
+                }
+
+                uint64_t const *pNeighbors(m_vNeighbors[rank].Words());
+                for (size_t otherWord = word; otherWord <= m_uLastWord; ++otherWord) {
+                    pColorClass[otherWord] &= ~pNeighbors[otherWord];
+                }
+
+                bClassIsEmpty = false;
+                if (bStoredClass) {
+                    m_vColorClasses[color-1].Insert(rank);
+                } else {
+                    m_vVerticesAboveThreshold.push_back(rank);
+                    m_vColorsAboveThreshold.push_back(color);
+                }
+            }
+        }
+
+        // every vertex was repaired into a lower class, reuse the color.
+        if (bClassIsEmpty) color--;
+    }
+
+    size_t currentIndex(0);
+    for (int currentColor = 0; currentColor < iNumStoredClassesUsed; ++currentColor) {
+        uint64_t *pClass(m_vColorClasses[currentColor].Words());
+        for (size_t word = m_uFirstWord; word <= m_uLastWord; ++word) {
+            uint64_t bits(pClass[word]);
+            while (bits != 0) {
+                int const bit(BitSet::LowestBit(bits));
+                bits &= (bits - 1);
+                vVerticesToReorder[currentIndex] = m_vVertex[(word << 6) + bit];
+                vColors[currentIndex] = currentColor+1;
+                currentIndex++;
+            }
+        }
+    }
+
+    for (size_t index = 0; index < m_vVerticesAboveThreshold.size(); ++index) {
+        vVerticesToReorder[currentIndex] = m_vVertex[m_vVerticesAboveThreshold[index]];
+        vColors[currentIndex] = m_vColorsAboveThreshold[index];
+        currentIndex++;
+    }
+}
+
+// Try to move the vertex into a class at or below the threshold that contains
+// exactly one of its neighbors, moving that neighbor to a later class (also at
+// or below the threshold) that contains none of its neighbors. Unlike
+// CliqueColoringStrategy, the neighbor is never moved above the threshold, as
+// that would not reduce the number of vertices left to branch on.
+bool BitSetCliqueColoringStrategy::Repair(int const rank, int const iBestCliqueDelta)
+{
+    m_uRepairAttempts++;
+    PerfPhase const phase(PerfProfile::Active(), PerfProfile::Repair);
+    int const iLastNextColor(iBestCliqueDelta - 1);
+    uint64_t const *pNeighbors(m_vNeighbors[rank].Words());
+    for (int newColor = 0; newColor < iLastNextColor; newColor++) {
+        uint64_t *pNewClass(m_vColorClasses[newColor].Words());
+        int conflictingVertex(-1);
+        int count(0);
+        for (size_t word = m_uFirstWord; word <= m_uLastWord && count <= 1; ++word) {
+            uint64_t const conflicts(pNewClass[word] & pNeighbors[word]);
+            if (conflicts == 0) continue;
+            count += BitSet::PopCount(conflicts);
+            conflictingVertex = (word << 6) + BitSet::LowestBit(conflicts);
+        }
+
+        if (count != 1) continue;
+
+        uint64_t const *pConflictNeighbors(m_vNeighbors[conflictingVertex].Words());
+        for (int nextColor = newColor+1; nextColor <= iLastNextColor; nextColor++) {
+            uint64_t const *pNextClass(m_vColorClasses[nextColor].Words());
+            bool bHasConflict(false);
+            for (size_t word = m_uFirstWord; word <= m_uLastWord; ++word) {
+                if (pNextClass[word] & pConflictNeighbors[word]) {
+                    bHasConflict = true;
+                    break;
+                }
+            }
+            if (bHasConflict) continue;
+
+            m_vColorClasses[newColor].Remove(conflictingVertex);
+            m_vColorClasses[newColor].Insert(rank);
+            m_vColorClasses[nextColor].Insert(conflictingVertex);
+            m_uRepairSuccesses++;
+            return true;
+        }
+    }
+    return false;
+}
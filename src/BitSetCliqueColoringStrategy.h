@@ -0,0 +1,55 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef BITSET_CLIQUE_COLORING_STRATEGY
+#define BITSET_CLIQUE_COLORING_STRATEGY
+
+#include "ColoringStrategy.h"
+#include "BitSet.h"
+
+#include <vector>
+
+// Drop-in replacement for CliqueColoringStrategy that builds color classes
+// by repeated bitset subtraction instead of probing the matrix once per
+// colored vertex. Vertices are numbered by their position in the order given
+// to SetVertexOrder, so that, for static orders, the coloring is the same as
+// the greedy coloring in CliqueColoringStrategy.
+class BitSetCliqueColoringStrategy : public ColoringStrategy
+{
+public:
+    BitSetCliqueColoringStrategy(std::vector<std::vector<char>> const &adjacencyMatrix);
+    void SetVertexOrder(std::vector<int> const &vVertexOrder);
+
+    virtual void Color(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors);
+    virtual void Recolor(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize);
+    bool Repair(int const vertex, int const iBestCliqueDelta);
+
+protected:
+    void InitializeUncolored(std::vector<int> const &vVertexOrder);
+
+    std::vector<std::vector<char>> const &m_AdjacencyMatrix;
+    std::vector<BitSet> m_vNeighbors; // indexed by rank
+    std::vector<int>    m_vRank;      // vertex -> rank
+    std::vector<int>    m_vVertex;    // rank -> vertex
+    std::vector<BitSet> m_vColorClasses;
+    std::vector<int>    m_vVerticesAboveThreshold;
+    std::vector<int>    m_vColorsAboveThreshold;
+    BitSet m_Uncolored;
+    BitSet m_ColorClass;
+    size_t m_uFirstWord;
+    size_t m_uLastWord;
+};
+
+#endif //BITSET_CLIQUE_COLORING_STRATEGY
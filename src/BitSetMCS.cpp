@@ -0,0 +1,317 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "BitSetMCS.h"
+#include "OrderingTools.h"
+#include "Tools.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+BitSetMCS::BitSetMCS(vector<vector<char>> const &vAdjacencyMatrix)
+: MaxSubgraphAlgorithm("bitset-mcs")
+, m_iNumVertices(vAdjacencyMatrix.size())
+, m_vNeighbors(vAdjacencyMatrix.size(), BitSet(vAdjacencyMatrix.size()))
+, m_vRank(vAdjacencyMatrix.size(), -1)
+, m_vVertex(vAdjacencyMatrix.size(), -1)
+, m_vStackBitP()
+, m_vStackBitOrder()
+, m_vStackBitColors()
+, m_Uncolored(vAdjacencyMatrix.size())
+, m_ColorClass(vAdjacencyMatrix.size())
+{
+    // rows are indexed by vertex until AdoptInitialOrder renumbers them by rank.
+    for (int vertex = 0; vertex < m_iNumVertices; ++vertex) {
+        for (int neighbor = 0; neighbor < m_iNumVertices; ++neighbor) {
+            if (vAdjacencyMatrix[vertex][neighbor]) m_vNeighbors[vertex].Insert(neighbor);
+        }
+    }
+
+    InitializeStacks();
+}
+
+BitSetMCS::BitSetMCS(CSRGraph const &graph)
+: MaxSubgraphAlgorithm("bitset-mcs")
+, m_iNumVertices(graph.NumVertices())
+, m_vNeighbors(graph.NumVertices(), BitSet(graph.NumVertices()))
+, m_vRank(graph.NumVertices(), -1)
+, m_vVertex(graph.NumVertices(), -1)
+, m_vStackBitP()
+, m_vStackBitOrder()
+, m_vStackBitColors()
+, m_Uncolored(graph.NumVertices())
+, m_ColorClass(graph.NumVertices())
+{
+    for (int vertex = 0; vertex < m_iNumVertices; ++vertex) {
+        for (int32_t const *pNeighbor = graph.Begin(vertex); pNeighbor != graph.End(vertex); ++pNeighbor) {
+            m_vNeighbors[vertex].Insert(*pNeighbor);
+        }
+    }
+
+    InitializeStacks();
+}
+
+void BitSetMCS::InitializeStacks()
+{
+    R.reserve(m_iNumVertices);
+}
+
+void BitSetMCS::InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors)
+{
+    vector<vector<int>> adjacencyArray(m_iNumVertices);
+    for (int vertex = 0; vertex < m_iNumVertices; ++vertex) {
+        for (int neighbor = 0; neighbor < m_iNumVertices; ++neighbor) {
+            if (m_vNeighbors[vertex].Contains(neighbor)) adjacencyArray[vertex].push_back(neighbor);
+        }
+    }
+
+    OrderingTools::InitialOrderingMCR(adjacencyArray, P, vColors, m_uMaximumCliqueSize);
+    vVertexOrder = P;
+}
+
+// renumber, so that coloring by increasing bit index evaluates vertices in
+// the same order as MCS's static order.
+void BitSetMCS::AdoptInitialOrder(std::vector<int> const &vVertexOrder)
+{
+    for (int rank = 0; rank < m_iNumVertices; ++rank) {
+        m_vVertex[rank] = vVertexOrder[rank];
+        m_vRank[vVertexOrder[rank]] = rank;
+    }
+
+    vector<BitSet> vNeighbors(m_iNumVertices, BitSet(m_iNumVertices));
+    for (int vertex = 0; vertex < m_iNumVertices; ++vertex) {
+        for (int neighbor = 0; neighbor < m_iNumVertices; ++neighbor) {
+            if (m_vNeighbors[vertex].Contains(neighbor)) vNeighbors[m_vRank[vertex]].Insert(m_vRank[neighbor]);
+        }
+    }
+    m_vNeighbors.swap(vNeighbors);
+}
+
+void BitSetMCS::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
+{
+    BitSet bitP(m_iNumVertices);
+    for (int const vertex : vVertexOrder) {
+        bitP.Insert(m_vRank[vertex]);
+    }
+
+    vector<int> vColorOrder;
+    ColorBitSet(bitP, vColorOrder, vColors, 0 /* record all vertices */);
+
+    vVerticesToReorder.resize(vColorOrder.size());
+    for (size_t index = 0; index < vColorOrder.size(); ++index) {
+        vVerticesToReorder[index] = m_vVertex[vColorOrder[index]];
+    }
+}
+
+void BitSetMCS::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVertexOrder, vector<int> const &P, int const chosenVertex)
+{
+    BitSet const &neighbors(m_vNeighbors[m_vRank[chosenVertex]]);
+    vNewVertexOrder.resize(vVertexOrder.size());
+    {
+        size_t uNewIndex(0);
+        for (int const candidate : vVertexOrder) {
+            if (neighbors.Contains(m_vRank[candidate])) vNewVertexOrder[uNewIndex++] = candidate;
+        }
+        vNewVertexOrder.resize(uNewIndex);
+    }
+
+    R.push_back(chosenVertex);
+}
+
+void BitSetMCS::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex)
+{
+    if (chosenVertex == -1) return;
+    vVertexOrder.erase(find(vVertexOrder.begin(), vVertexOrder.end(), chosenVertex));
+    R.pop_back();
+}
+
+// Greedy sequential coloring, one color class at a time: take the uncolored
+// vertices, and peel off the lowest vertex and its neighbors word by word
+// until the class is maximal. Only vertices with color > iMinimumColor are
+// recorded, as the others can never be branched on.
+void BitSetMCS::ColorBitSet(BitSet const &P, vector<int> &vColorOrder, vector<int> &vColors, int const iMinimumColor)
+{
+    vColorOrder.clear();
+    vColors.clear();
+
+    m_Uncolored = P;
+
+    size_t const numWords(P.NumWords());
+    uint64_t *pUncolored(m_Uncolored.Words());
+    uint64_t *pColorClass(m_ColorClass.Words());
+
+    size_t uNumUncolored(m_Uncolored.Size());
+    size_t uFirstWord(0);
+    int color(0);
+
+    while (uNumUncolored > 0) {
+        color++;
+        while (pUncolored[uFirstWord] == 0) uFirstWord++;
+
+        for (size_t word = uFirstWord; word < numWords; ++word) {
+            pColorClass[word] = pUncolored[word];
+        }
+
+        for (size_t word = uFirstWord; word < numWords; ++word) {
+            while (pColorClass[word] != 0) {
+                int const bit(BitSet::LowestBit(pColorClass[word]));
+                int const vertex((word << 6) + bit);
+                uint64_t const mask(~(static_cast<uint64_t>(1) << bit));
+                pColorClass[word] &= mask;
+                pUncolored[word]  &= mask;
+                uNumUncolored--;
+
+                uint64_t const *pNeighbors(m_vNeighbors[vertex].Words());
+                for (size_t otherWord = word; otherWord < numWords; ++otherWord) {
+                    pColorClass[otherWord] &= ~pNeighbors[otherWord];
+                }
+
+                if (color > iMinimumColor) {
+                    vColorOrder.push_back(vertex);
+                    vColors.push_back(color);
+                }
+            }
+        }
+    }
+}
+
+void BitSetMCS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    nodeCount++;
+    if (SearchLimitReached()) return;
+    if (P.empty()) return;
+
+    // the initial coloring bounds the clique size, and therefore the depth;
+    // a single vertex is left uncolored (-1).
+    size_t const uMaxDepth(R.size() + max(vColors.back(), 0) + 2);
+    m_vStackBitP.resize(uMaxDepth, BitSet(m_iNumVertices));
+    m_vStackBitOrder.resize(uMaxDepth);
+    m_vStackBitColors.resize(uMaxDepth);
+
+    BitSet &bitP(m_vStackBitP[R.size()]);
+    BitSet &vNewP(m_vStackBitP[R.size()+1]);
+    bitP.Clear();
+    for (int const vertex : P) {
+        bitP.Insert(m_vRank[vertex]);
+    }
+
+    // the root uses the initial coloring, as MCS does.
+    while (!P.empty()) {
+        if (depth == 0) {
+            if (!m_bQuiet) {
+                cout << "Only " << P.size() << " more vertices to go! " << Tools::GetTimeInSeconds(clock() - startTime) << endl;
+            }
+        }
+
+        SynchronizeMaximumCliqueSize();
+
+        int const largestColor(vColors.back());
+        if (R.size() + largestColor <= m_uMaximumCliqueSize) {
+            break;
+        }
+
+        m_uSearchBound = R.size() + largestColor;
+
+        vColors.pop_back();
+        int const nextVertex(P.back()); P.pop_back();
+        int const rank(m_vRank[nextVertex]);
+
+        if (!ClaimRootBranch()) {
+            // another worker evaluates this branch.
+            bitP.Remove(rank);
+            continue;
+        }
+
+        vNewP.Intersect(bitP, m_vNeighbors[rank]);
+        R.push_back(nextVertex);
+
+        if (!vNewP.Empty()) {
+            depth++;
+            ExpandBitSet(cliques);
+            depth--;
+        } else if (R.size() > m_uMaximumCliqueSize) {
+            RecordClique(cliques);
+        }
+
+        R.pop_back();
+        if (m_bSearchStopped) return;
+        bitP.Remove(rank);
+    }
+
+    m_uSearchBound = 0; // every branch was evaluated
+    P.clear();
+}
+
+void BitSetMCS::ExpandBitSet(list<list<int>> &cliques)
+{
+    nodeCount++;
+    if (SearchLimitReached()) return;
+
+    if (nodeCount%10000 == 0) {
+        if (!m_bQuiet) {
+            cout << "Evaluated " << nodeCount << " nodes. " << Tools::GetTimeInSeconds(clock() - startTime) << endl;
+            PrintState();
+        }
+    }
+
+    BitSet           &bitP(m_vStackBitP[R.size()]);
+    BitSet           &vNewP(m_vStackBitP[R.size()+1]);
+    vector<int>      &vColorOrder(m_vStackBitOrder[R.size()]);
+    vector<int>      &vColors(m_vStackBitColors[R.size()]);
+
+    ColorBitSet(bitP, vColorOrder, vColors, static_cast<int>(m_uMaximumCliqueSize) - static_cast<int>(R.size()));
+
+    while (!vColorOrder.empty()) {
+        SynchronizeMaximumCliqueSize();
+
+        int const largestColor(vColors.back());
+        if (R.size() + largestColor <= m_uMaximumCliqueSize) {
+            break;
+        }
+
+        vColors.pop_back();
+        int const nextVertex(vColorOrder.back()); vColorOrder.pop_back();
+
+        vNewP.Intersect(bitP, m_vNeighbors[nextVertex]);
+        R.push_back(m_vVertex[nextVertex]);
+
+        if (!vNewP.Empty()) {
+            depth++;
+            ExpandBitSet(cliques);
+            depth--;
+        } else if (R.size() > m_uMaximumCliqueSize) {
+            RecordClique(cliques);
+        }
+
+        R.pop_back();
+        if (m_bSearchStopped) return;
+        bitP.Remove(nextVertex);
+    }
+
+    vColorOrder.clear();
+    vColors.clear();
+}
+
+void BitSetMCS::PrintState() const
+{
+    cout << "(";
+    for (size_t index = 0; index <= R.size(); ++index) {
+        cout << m_vStackBitP[index].Size();
+        if (index != R.size()) cout << ", ";
+    }
+    cout << ")" << endl << flush;
+}
@@ -0,0 +1,63 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef BITSET_MCS_H
+#define BITSET_MCS_H
+
+#include "MaxSubgraphAlgorithm.h"
+#include "BitSet.h"
+#include "CSRGraph.h"
+
+#include <vector>
+#include <list>
+
+// Bit-parallel variant of MCS (in the style of BBMC): vertices are renumbered
+// by the MCR initial ordering, adjacency rows are packed 64 vertices per word,
+// and candidate sets are bitsets, so that P \cap N(v) is a word-wise AND.
+class BitSetMCS : public MaxSubgraphAlgorithm
+{
+public:
+    BitSetMCS(std::vector<std::vector<char>> const &vAdjacencyMatrix);
+    BitSetMCS(CSRGraph const &graph);
+
+    virtual void Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors);
+
+    virtual void InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors);
+    virtual void AdoptInitialOrder(std::vector<int> const &vVertexOrder);
+    virtual void GetNewOrder(std::vector<int> &vNewVertexOrder, std::vector<int> &vVertexOrder, std::vector<int> const &P, int const chosenVertex);
+    virtual void ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex);
+    virtual void ProcessOrderBeforeReturn(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors) {}
+
+    virtual void RunRecursive(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
+
+    virtual void PrintState() const;
+
+protected:
+    void InitializeStacks();
+    void ExpandBitSet(std::list<std::list<int>> &cliques);
+    void ColorBitSet(BitSet const &P, std::vector<int> &vColorOrder, std::vector<int> &vColors, int const iMinimumColor);
+
+    int m_iNumVertices;
+    std::vector<BitSet> m_vNeighbors;   // indexed by rank in the initial ordering
+    std::vector<int>    m_vRank;        // vertex -> rank
+    std::vector<int>    m_vVertex;      // rank -> vertex
+    std::vector<BitSet> m_vStackBitP;   // candidate set at each depth, by rank
+    std::vector<std::vector<int>> m_vStackBitOrder;
+    std::vector<std::vector<int>> m_vStackBitColors;
+    BitSet m_Uncolored;
+    BitSet m_ColorClass;
+};
+
+#endif //BITSET_MCS_H
@@ -0,0 +1,237 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "CSRGraph.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+CSRGraph::CSRGraph()
+: m_uNumVertices(0)
+, m_uNumEntries(0)
+, m_pOffsets(nullptr)
+, m_pNeighbors(nullptr)
+, m_vOffsets(1, 0)
+, m_vNeighbors()
+, m_pMappedFile(nullptr)
+, m_uMappedSize(0)
+{
+    m_pOffsets = m_vOffsets.data();
+}
+
+CSRGraph::~CSRGraph()
+{
+    Unmap();
+}
+
+void CSRGraph::Unmap()
+{
+    if (m_pMappedFile != nullptr) {
+        munmap(m_pMappedFile, m_uMappedSize);
+        m_pMappedFile = nullptr;
+        m_uMappedSize = 0;
+    }
+}
+
+bool CSRGraph::IsCSRFile(string const &fileName)
+{
+    FILE *pFile(fopen(fileName.c_str(), "rb"));
+    if (pFile == nullptr) return false;
+
+    char magic[8];
+    bool const bIsCSR(fread(magic, 1, sizeof(magic), pFile) == sizeof(magic) && memcmp(magic, Magic(), sizeof(magic)) == 0);
+    fclose(pFile);
+    return bIsCSR;
+}
+
+void CSRGraph::Load(string const &fileName)
+{
+    int const fileDescriptor(open(fileName.c_str(), O_RDONLY));
+    if (fileDescriptor < 0) {
+        fprintf(stderr, "ERROR: Unable to open file %s\n", fileName.c_str());
+        exit(1);
+    }
+
+    struct stat fileStats;
+    if (fstat(fileDescriptor, &fileStats) != 0 || static_cast<size_t>(fileStats.st_size) < sizeof(Header)) {
+        fprintf(stderr, "ERROR: File %s is too small to be a CSR graph\n", fileName.c_str());
+        exit(1);
+    }
+
+    size_t const fileSize(fileStats.st_size);
+    void *pMappedFile(mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0));
+    close(fileDescriptor);
+
+    if (pMappedFile == MAP_FAILED) {
+        fprintf(stderr, "ERROR: Unable to map file %s\n", fileName.c_str());
+        exit(1);
+    }
+
+    Header const *pHeader(static_cast<Header const*>(pMappedFile));
+    if (memcmp(pHeader->magic, Magic(), sizeof(pHeader->magic)) != 0) {
+        fprintf(stderr, "ERROR: File %s is not a CSR graph\n", fileName.c_str());
+        exit(1);
+    }
+
+    // bound the counts by the file size first, so the expected size can't overflow.
+    if (pHeader->numVertices >= fileSize/sizeof(int64_t) || pHeader->numEntries > fileSize/sizeof(int32_t) || pHeader->numVertices > INT32_MAX) {
+        fprintf(stderr, "ERROR: CSR graph %s has a corrupt header\n", fileName.c_str());
+        exit(1);
+    }
+
+    size_t const expectedSize(sizeof(Header) + (pHeader->numVertices + 1)*sizeof(int64_t) + pHeader->numEntries*sizeof(int32_t));
+    if (fileSize != expectedSize) {
+        fprintf(stderr, "ERROR: CSR graph %s has size %zu, expected %zu\n", fileName.c_str(), fileSize, expectedSize);
+        exit(1);
+    }
+
+    Unmap();
+    m_vOffsets.clear();
+    m_vNeighbors.clear();
+
+    m_pMappedFile  = pMappedFile;
+    m_uMappedSize  = fileSize;
+    m_uNumVertices = pHeader->numVertices;
+    m_uNumEntries  = pHeader->numEntries;
+    m_pOffsets     = reinterpret_cast<int64_t const*>(static_cast<char const*>(pMappedFile) + sizeof(Header));
+    m_pNeighbors   = reinterpret_cast<int32_t const*>(m_pOffsets + m_uNumVertices + 1);
+
+    // the neighbors are read in order, so let the kernel read ahead.
+    madvise(m_pMappedFile, m_uMappedSize, MADV_SEQUENTIAL);
+
+    // the file is trusted no more than a text graph: a corrupt one must not be read out of bounds.
+    if (m_pOffsets[0] != 0 || static_cast<size_t>(m_pOffsets[m_uNumVertices]) != m_uNumEntries) {
+        fprintf(stderr, "ERROR: CSR graph %s has inconsistent offsets\n", fileName.c_str());
+        exit(1);
+    }
+
+    for (size_t vertex = 0; vertex < m_uNumVertices; ++vertex) {
+        if (m_pOffsets[vertex] > m_pOffsets[vertex+1]) {
+            fprintf(stderr, "ERROR: CSR graph %s has decreasing offsets at vertex %zu\n", fileName.c_str(), vertex);
+            exit(1);
+        }
+    }
+
+    // neighbors must be sorted, as the sparse algorithms binary-search them.
+    for (size_t vertex = 0; vertex < m_uNumVertices; ++vertex) {
+        for (int32_t const *pNeighbor = Begin(vertex); pNeighbor != End(vertex); ++pNeighbor) {
+            if (*pNeighbor < 0 || static_cast<size_t>(*pNeighbor) >= m_uNumVertices) {
+                fprintf(stderr, "ERROR: CSR graph %s has neighbor %d of vertex %zu out of range [0, %zu)\n", fileName.c_str(), *pNeighbor, vertex, m_uNumVertices);
+                exit(1);
+            }
+            if (static_cast<size_t>(*pNeighbor) == vertex) {
+                fprintf(stderr, "ERROR: CSR graph %s has a loop at vertex %zu\n", fileName.c_str(), vertex);
+                exit(1);
+            }
+            if (pNeighbor != Begin(vertex) && *pNeighbor <= *(pNeighbor - 1)) {
+                fprintf(stderr, "ERROR: CSR graph %s has unsorted or repeated neighbors of vertex %zu\n", fileName.c_str(), vertex);
+                exit(1);
+            }
+        }
+    }
+}
+
+void CSRGraph::Write(string const &fileName) const
+{
+    FILE *pFile(fopen(fileName.c_str(), "wb"));
+    if (pFile == nullptr) {
+        fprintf(stderr, "ERROR: Unable to open file %s for writing\n", fileName.c_str());
+        exit(1);
+    }
+
+    Header header;
+    memcpy(header.magic, Magic(), sizeof(header.magic));
+    header.numVertices = m_uNumVertices;
+    header.numEntries  = m_uNumEntries;
+
+    bool bWritten(fwrite(&header, sizeof(Header), 1, pFile) == 1);
+    bWritten = bWritten && fwrite(m_pOffsets, sizeof(int64_t), m_uNumVertices + 1, pFile) == m_uNumVertices + 1;
+    bWritten = bWritten && fwrite(m_pNeighbors, sizeof(int32_t), m_uNumEntries, pFile) == m_uNumEntries;
+
+    if (fclose(pFile) != 0 || !bWritten) {
+        fprintf(stderr, "ERROR: Problem writing file %s\n", fileName.c_str());
+        exit(1);
+    }
+}
+
+void CSRGraph::BuildFromAdjacencyList(vector<list<int>> const &adjacencyList)
+{
+    vector<int64_t> vOffsets(adjacencyList.size() + 1, 0);
+    vector<int32_t> vNeighbors;
+
+    size_t uNumEntries(0);
+    for (list<int> const &neighbors : adjacencyList) {
+        uNumEntries += neighbors.size();
+    }
+    vNeighbors.reserve(uNumEntries);
+
+    for (size_t vertex = 0; vertex < adjacencyList.size(); ++vertex) {
+        size_t const uFirst(vNeighbors.size());
+        vNeighbors.insert(vNeighbors.end(), adjacencyList[vertex].begin(), adjacencyList[vertex].end());
+        sort(vNeighbors.begin() + uFirst, vNeighbors.end());
+        vNeighbors.erase(unique(vNeighbors.begin() + uFirst, vNeighbors.end()), vNeighbors.end());
+        vOffsets[vertex+1] = vNeighbors.size();
+    }
+
+    BuildFromOffsetsAndNeighbors(vOffsets, vNeighbors);
+}
+
+// takes ownership of the arrays, which are left empty.
+void CSRGraph::BuildFromOffsetsAndNeighbors(vector<int64_t> &vOffsets, vector<int32_t> &vNeighbors)
+{
+    Unmap();
+
+    m_vOffsets.swap(vOffsets);
+    m_vNeighbors.swap(vNeighbors);
+    vOffsets.clear();
+    vNeighbors.clear();
+
+    m_uNumVertices = m_vOffsets.size() - 1;
+    m_uNumEntries  = m_vNeighbors.size();
+    m_pOffsets     = m_vOffsets.data();
+    m_pNeighbors   = m_vNeighbors.data();
+}
+
+void CSRGraph::BuildAdjacencyMatrix(vector<vector<char>> &vAdjacencyMatrix, bool const addDiagonals) const
+{
+    vAdjacencyMatrix.resize(m_uNumVertices);
+    for (size_t vertex = 0; vertex < m_uNumVertices; ++vertex) {
+        vector<char> &row(vAdjacencyMatrix[vertex]);
+        row.assign(m_uNumVertices, 0);
+        for (int32_t const *pNeighbor = Begin(vertex); pNeighbor != End(vertex); ++pNeighbor) {
+            row[*pNeighbor] = 1;
+        }
+        if (addDiagonals) {
+            row[vertex] = 1;
+        }
+    }
+}
+
+void CSRGraph::BuildAdjacencyArray(vector<vector<int>> &adjacencyArray) const
+{
+    adjacencyArray.resize(m_uNumVertices);
+    for (size_t vertex = 0; vertex < m_uNumVertices; ++vertex) {
+        adjacencyArray[vertex].assign(Begin(vertex), End(vertex));
+    }
+}
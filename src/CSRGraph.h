@@ -0,0 +1,85 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <vector>
+#include <list>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+// A graph in compressed sparse row form: the neighbors of vertex v are
+// pNeighbors[pOffsets[v]] ... pNeighbors[pOffsets[v+1]-1], in increasing
+// order. Each edge appears once in each direction.
+//
+// The binary file (.csr) is the header below, followed by numVertices+1
+// int64 offsets and numEntries int32 neighbors, in native byte order. Loaded
+// files are mmap'd, so the arrays are only paged in as they are read.
+class CSRGraph
+{
+public:
+    static char const *Magic() { return "OMCSCSR1"; }
+
+    struct Header
+    {
+        char     magic[8];
+        uint64_t numVertices;
+        uint64_t numEntries; // 2x number of edges
+    };
+
+    CSRGraph();
+    ~CSRGraph();
+
+    CSRGraph(CSRGraph const &) = delete;
+    CSRGraph &operator=(CSRGraph const &) = delete;
+
+    static bool IsCSRFile(std::string const &fileName);
+
+    void Load(std::string const &fileName);
+    void Write(std::string const &fileName) const;
+
+    void BuildFromAdjacencyList(std::vector<std::list<int>> const &adjacencyList);
+    void BuildFromOffsetsAndNeighbors(std::vector<int64_t> &vOffsets, std::vector<int32_t> &vNeighbors);
+
+    void BuildAdjacencyMatrix(std::vector<std::vector<char>> &vAdjacencyMatrix, bool const addDiagonals) const;
+    void BuildAdjacencyArray(std::vector<std::vector<int>> &adjacencyArray) const;
+
+    int     NumVertices() const { return static_cast<int>(m_uNumVertices); }
+    size_t  NumEntries()  const { return m_uNumEntries; }
+    size_t  Degree(int const vertex)         const { return m_pOffsets[vertex+1] - m_pOffsets[vertex]; }
+    int32_t const *Begin(int const vertex)   const { return m_pNeighbors + m_pOffsets[vertex]; }
+    int32_t const *End(int const vertex)     const { return m_pNeighbors + m_pOffsets[vertex+1]; }
+
+    int64_t const *Offsets()   const { return m_pOffsets; }
+    int32_t const *Neighbors() const { return m_pNeighbors; }
+
+private:
+    void Unmap();
+
+    size_t m_uNumVertices;
+    size_t m_uNumEntries;
+    int64_t const *m_pOffsets;
+    int32_t const *m_pNeighbors;
+
+    // storage, either owned or mapped from a file
+    std::vector<int64_t> m_vOffsets;
+    std::vector<int32_t> m_vNeighbors;
+    void  *m_pMappedFile;
+    size_t m_uMappedSize;
+};
+
+#endif //CSR_GRAPH_H
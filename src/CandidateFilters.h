@@ -0,0 +1,103 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef CANDIDATE_FILTERS_H
+#define CANDIDATE_FILTERS_H
+
+#include <vector>
+#include <algorithm>
+
+// The loops of GetNewOrder that filter a child's candidates out of its
+// parent's order, shared with open-mcs-kernel-bench so that it times the
+// same code as the search. Each keeps the order of vCandidates.
+namespace CandidateFilters
+{
+    // the candidates adjacent to chosenVertex.
+    inline void Neighbors(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vCandidates, int const chosenVertex, std::vector<int> &vNewVertexOrder)
+    {
+        std::vector<char> const &row(adjacencyMatrix[chosenVertex]);
+        vNewVertexOrder.resize(vCandidates.size());
+        size_t uNewIndex(0);
+        for (int const candidate : vCandidates) {
+            if (row[candidate]) vNewVertexOrder[uNewIndex++] = candidate;
+        }
+        vNewVertexOrder.resize(uNewIndex);
+    }
+
+    // the candidates other than chosenVertex that are not adjacent to it.
+    inline void NonNeighbors(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vCandidates, int const chosenVertex, std::vector<int> &vNewVertexOrder)
+    {
+        std::vector<char> const &row(adjacencyMatrix[chosenVertex]);
+        vNewVertexOrder.resize(vCandidates.size());
+        size_t uNewIndex(0);
+        for (int const candidate : vCandidates) {
+            if (chosenVertex == candidate) continue;
+            if (!row[candidate]) vNewVertexOrder[uNewIndex++] = candidate;
+        }
+        vNewVertexOrder.resize(uNewIndex);
+    }
+
+    // the candidates adjacent to chosenVertex, by marking its neighbors in
+    // vbMarks (all zero, and left that way).
+    inline void MarkedNeighbors(std::vector<std::vector<int>> const &adjacencyArray, std::vector<char> &vbMarks, std::vector<int> const &vCandidates, int const chosenVertex, std::vector<int> &vNewVertexOrder)
+    {
+        std::vector<int> const &neighbors(adjacencyArray[chosenVertex]);
+        vNewVertexOrder.clear();
+        for (int const neighbor : neighbors) vbMarks[neighbor] = 1;
+        for (int const candidate : vCandidates) {
+            if (vbMarks[candidate]) vNewVertexOrder.push_back(candidate);
+        }
+        for (int const neighbor : neighbors) vbMarks[neighbor] = 0;
+    }
+
+    // the candidates other than chosenVertex that are not adjacent to it, by
+    // marking its neighbors in vbMarks (all zero, and left that way).
+    inline void MarkedNonNeighbors(std::vector<std::vector<int>> const &adjacencyArray, std::vector<char> &vbMarks, std::vector<int> const &vCandidates, int const chosenVertex, std::vector<int> &vNewVertexOrder)
+    {
+        std::vector<int> const &neighbors(adjacencyArray[chosenVertex]);
+        vNewVertexOrder.clear();
+        for (int const neighbor : neighbors) vbMarks[neighbor] = 1;
+        vbMarks[chosenVertex] = 1;
+        for (int const candidate : vCandidates) {
+            if (!vbMarks[candidate]) vNewVertexOrder.push_back(candidate);
+        }
+        for (int const neighbor : neighbors) vbMarks[neighbor] = 0;
+        vbMarks[chosenVertex] = 0;
+    }
+
+    // the candidates adjacent to chosenVertex, by binary search in its
+    // (sorted) neighbors, for few candidates and many neighbors.
+    inline void SearchedNeighbors(std::vector<std::vector<int>> const &adjacencyArray, std::vector<int> const &vCandidates, int const chosenVertex, std::vector<int> &vNewVertexOrder)
+    {
+        std::vector<int> const &neighbors(adjacencyArray[chosenVertex]);
+        vNewVertexOrder.clear();
+        for (int const candidate : vCandidates) {
+            if (std::binary_search(neighbors.begin(), neighbors.end(), candidate)) vNewVertexOrder.push_back(candidate);
+        }
+    }
+
+    // the candidates other than chosenVertex that are not adjacent to it, by
+    // binary search in its (sorted) neighbors.
+    inline void SearchedNonNeighbors(std::vector<std::vector<int>> const &adjacencyArray, std::vector<int> const &vCandidates, int const chosenVertex, std::vector<int> &vNewVertexOrder)
+    {
+        std::vector<int> const &neighbors(adjacencyArray[chosenVertex]);
+        vNewVertexOrder.clear();
+        for (int const candidate : vCandidates) {
+            if (candidate != chosenVertex && !std::binary_search(neighbors.begin(), neighbors.end(), candidate)) vNewVertexOrder.push_back(candidate);
+        }
+    }
+};
+
+#endif //CANDIDATE_FILTERS_H
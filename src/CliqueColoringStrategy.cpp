@@ -14,6 +14,7 @@
 */
 
 #include "CliqueColoringStrategy.h"
+#include "PerfCounters.h"
 #include "DegeneracyTools.h"
 
 #include <cmath>
@@ -23,7 +24,7 @@
 
 using namespace std;
 
-CliqueColoringStrategy::CliqueColoringStrategy(vector<vector<char>> const &adjacencyMatrix) : ColoringStrategy(), m_AdjacencyMatrix(adjacencyMatrix), m_vvVerticesWithColor()////, m_Colors(adjacencyList.size(), -1) , m_VertexOrder()
+CliqueColoringStrategy::CliqueColoringStrategy(vector<vector<char>> const &adjacencyMatrix) : ColoringStrategy(), m_AdjacencyMatrix(adjacencyMatrix), m_vvVerticesWithColor(), m_vbRecolor(adjacencyMatrix.size(), 0)////, m_Colors(adjacencyList.size(), -1) , m_VertexOrder()
 {
     m_vvVerticesWithColor.resize(adjacencyMatrix.size());
     for (vector<int> vVertices : m_vvVerticesWithColor) {
@@ -207,6 +208,73 @@ void CliqueColoringStrategy::Recolor(vector<vector<char>> const &adjacencyMatrix
 #endif // DEBUG
 }
 
+// Siblings differ by one vertex, so the parent's classes, filtered to the
+// neighbors of chosenVertex, are still independent sets. The classes that
+// lost no vertex are kept as they are (up to the colors that the search
+// prunes), and only the vertices of the classes that changed are recolored,
+// greedily in vVertexOrder and with Repair if bRepair, as Recolor would.
+void CliqueColoringStrategy::IncrementalRecolor(vector<vector<char>> const &adjacencyMatrix, vector<int> const &vVertexOrder, vector<int> const &vParentP, vector<int> const &vParentColors, int const chosenVertex, vector<int> &vVerticesToReorder, vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize, bool const bRepair)
+{
+    if (vVertexOrder.empty()) return;
+
+    int const iBestCliqueDelta(currentBestCliqueSize - currentCliqueSize);
+    vector<char> const &chosenNeighbors(adjacencyMatrix[chosenVertex]);
+
+    int numKeptClasses(0);
+    size_t classBegin(0);
+    while (classBegin < vParentP.size()) {
+        size_t classEnd(classBegin);
+        bool bUnchanged(true);
+        while (classEnd < vParentP.size() && vParentColors[classEnd] == vParentColors[classBegin]) {
+            bUnchanged = bUnchanged && chosenNeighbors[vParentP[classEnd]];
+            classEnd++;
+        }
+
+        for (size_t index = classBegin; index < classEnd; ++index) {
+            int const vertex(vParentP[index]);
+            if (!chosenNeighbors[vertex]) continue;
+            if (bUnchanged && numKeptClasses < iBestCliqueDelta) {
+                m_vvVerticesWithColor[numKeptClasses].push_back(vertex);
+            } else {
+                m_vbRecolor[vertex] = 1;
+            }
+        }
+        if (bUnchanged && numKeptClasses < iBestCliqueDelta) numKeptClasses++;
+        classBegin = classEnd;
+    }
+
+    int maxColor(numKeptClasses-1);
+
+    for (int const vertex : vVertexOrder) {
+        if (!m_vbRecolor[vertex]) continue;
+        m_vbRecolor[vertex] = 0;
+
+        int color = 0;
+        for (vector<int> const &verticesWithColor : m_vvVerticesWithColor) {
+            if (verticesWithColor.empty() || !HasConflict(vertex, verticesWithColor)) break;
+            color++;
+        }
+
+        m_vvVerticesWithColor[color].push_back(vertex);
+        maxColor = max(maxColor, color);
+        if (bRepair && color+1 > iBestCliqueDelta && color == maxColor) {
+            Repair(vertex, color, iBestCliqueDelta);
+            if (m_vvVerticesWithColor[maxColor].empty())
+                maxColor--;
+        }
+    }
+
+    int currentIndex(0);
+    for (int currentColor = 0; currentColor <= maxColor; ++currentColor) {
+        for (int const vertex : m_vvVerticesWithColor[currentColor]) {
+            vVerticesToReorder[currentIndex] = vertex;
+            vColors[currentIndex] = currentColor+1;
+            currentIndex++;
+        }
+        m_vvVerticesWithColor[currentColor].clear();
+    }
+}
+
 bool CliqueColoringStrategy::HasConflict(int const vertex, vector<int> const &vVerticesWithColor)
 {
     if (vVerticesWithColor.empty()) return false;
@@ -236,6 +304,8 @@ int CliqueColoringStrategy::GetConflictingVertex(int const vertex, vector<int> c
 
 bool CliqueColoringStrategy::Repair(int const vertex, int const color, int const iBestCliqueDelta)
 {
+    m_uRepairAttempts++;
+    PerfPhase const phase(PerfProfile::Active(), PerfProfile::Repair);
     for (int newColor = 0; newColor <= iBestCliqueDelta-1; newColor++) {
         int const conflictingVertex(GetConflictingVertex(vertex, m_vvVerticesWithColor[newColor]));
         if (conflictingVertex < 0) continue;
@@ -246,6 +316,7 @@ bool CliqueColoringStrategy::Repair(int const vertex, int const color, int const
             m_vvVerticesWithColor[newColor].push_back(vertex);
             m_vvVerticesWithColor[nextColor].push_back(conflictingVertex);
 ////            cout << "Repairing vertices " << vertex << " and " << conflictingVertex << endl;
+            m_uRepairSuccesses++;
             return true;
         }
     }
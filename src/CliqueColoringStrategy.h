@@ -24,6 +24,10 @@ public:
     CliqueColoringStrategy(std::vector<std::vector<char>> const &adjacencyMatrix);
     virtual void Color(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors);
     virtual void Recolor(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize);
+    // color the neighbors of chosenVertex among the parent's candidates
+    // vParentP, from the parent's classes instead of from scratch.
+    void IncrementalRecolor(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> const &vParentP, std::vector<int> const &vParentColors, int const chosenVertex, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize, bool const bRepair);
+
     bool HasConflict(int const vertex, std::vector<int> const &vVerticesWithColor);
     int  GetConflictingVertex(int const vertex, std::vector<int> const &vVerticesWithColor);
     bool Repair(int const vertex, int const color, int const iBestCliqueDelta);
@@ -33,6 +37,7 @@ public:
 protected:
     std::vector<std::vector<char>> const &m_AdjacencyMatrix;
     std::vector<std::vector<int>> m_vvVerticesWithColor;
+    std::vector<char> m_vbRecolor; // vertex -> in a class that IncrementalRecolor recolors
 ////    std::vector<int> m_Colors;
 ////    std::vector<int> m_VertexOrder;
 };
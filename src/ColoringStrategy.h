@@ -17,11 +17,13 @@
 #define COLORING_STRATEGY_H
 
 #include <vector>
+#include <cstddef>
 
 class ColoringStrategy
 {
 public:
-    ColoringStrategy() {}
+    ColoringStrategy() : m_uRepairAttempts(0), m_uRepairSuccesses(0) {}
+    virtual ~ColoringStrategy() {}
     virtual void Color(std::vector<std::vector<int>>  const &adjacencyList, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors) {};
     virtual void Color(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors) {};
 
@@ -29,9 +31,19 @@ public:
     virtual int ColorWithoutReorder(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors) { return 0; }
     virtual void Recolor(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors) {};
     virtual void Recolor(std::vector<std::vector<int>> const &adjacencyArray, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors) {};
+    virtual void Recolor(std::vector<std::vector<char>> const &adjacencyMatrix, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize) {};
+    virtual void Recolor(std::vector<std::vector<int>> const &adjacencyArray, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors, int const currentBestCliqueSize, int const currentCliqueSize) {};
 ////    virtual void Recolor() = 0;
 ////    virtual void RemoveVertex(int const vertex) = 0;
 ////    virtual void PeekAtNextVertexAndColor(int &vertex, int &color) = 0;
+
+    // calls to Repair, and how many of them moved the vertex to a lower color.
+    size_t GetRepairAttempts() const  { return m_uRepairAttempts; }
+    size_t GetRepairSuccesses() const { return m_uRepairSuccesses; }
+
+protected:
+    size_t m_uRepairAttempts;
+    size_t m_uRepairSuccesses;
 };
 
 #endif //COLORING_STRATEGY_H
@@ -0,0 +1,157 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "ComponentMISS.h"
+#include "SearchLimits.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+ComponentMISS::ComponentMISS(string const &name, vector<vector<int>> const &adjacencyArray, function<Algorithm*(vector<vector<int>> const &)> createComponentAlgorithm)
+: Algorithm(name)
+, m_Reductions(adjacencyArray)
+, m_CreateComponentAlgorithm(createComponentAlgorithm)
+, m_uNumComponents(0)
+, m_uLargestComponent(0)
+, m_uNumUnsolved(0)
+, m_uNodeCount(0)
+, m_uUpperBound(0)
+, m_StartTime(clock())
+, m_TimeToLargestClique(0)
+{
+}
+
+ComponentMISS::~ComponentMISS()
+{
+    if (!GetQuiet()) {
+        m_Reductions.PrintStatistics();
+        cerr << "Components         : " << m_uNumComponents << endl;
+        cerr << "Largest Component  : " << m_uLargestComponent << endl;
+        cerr << "Unsolved Components: " << m_uNumUnsolved << endl;
+        cerr << "Search Nodes       : " << m_uNodeCount << endl;
+    }
+}
+
+long ComponentMISS::Run(list<list<int>> &cliques)
+{
+    cliques.push_back(list<int>());
+    list<int> &independentSet(cliques.back());
+
+    m_Reductions.Reduce();
+
+    vector<vector<int>> vKernel;
+    vector<int> vKernelVertices;
+    m_Reductions.GetKernel(vKernel, vKernelVertices);
+    m_uUpperBound = m_Reductions.GetNumTaken();
+
+    vector<vector<int>> vComponents;
+    ComputeComponents(vKernel, vComponents);
+    m_uNumComponents = vComponents.size();
+
+    // small components finish quickly, so a search limit stops a large one.
+    sort(vComponents.begin(), vComponents.end(), [](vector<int> const &first, vector<int> const &second) { return first.size() < second.size(); });
+
+    vector<int> vLocalIndex(vKernel.size(), -1);
+    for (vector<int> const &vComponent : vComponents) {
+        m_uLargestComponent = max(m_uLargestComponent, vComponent.size());
+        if (SearchLimitReached()) {
+            m_uUpperBound += vComponent.size();
+            m_uNumUnsolved++;
+            continue;
+        }
+
+        SolveComponent(vKernel, vComponent, vLocalIndex, independentSet);
+    }
+
+    for (int &vertex : independentSet) {
+        vertex = vKernelVertices[vertex];
+    }
+    m_Reductions.LiftSolution(independentSet);
+
+    m_TimeToLargestClique = clock() - m_StartTime;
+    RecordTimeOfLargestClique();
+    ExecuteCallBacks(independentSet);
+
+    return cliques.size();
+}
+
+void ComponentMISS::ComputeComponents(vector<vector<int>> const &adjacencyArray, vector<vector<int>> &vComponents) const
+{
+    vector<char> vbVisited(adjacencyArray.size(), 0);
+    for (size_t start = 0; start < adjacencyArray.size(); ++start) {
+        if (vbVisited[start]) continue;
+
+        vComponents.push_back(vector<int>(1, start));
+        vector<int> &vComponent(vComponents.back());
+        vbVisited[start] = 1;
+        for (size_t index = 0; index < vComponent.size(); ++index) {
+            for (int const neighbor : adjacencyArray[vComponent[index]]) {
+                if (vbVisited[neighbor]) continue;
+                vbVisited[neighbor] = 1;
+                vComponent.push_back(neighbor);
+            }
+        }
+
+        // in increasing order, see SolveComponent.
+        sort(vComponent.begin(), vComponent.end());
+    }
+}
+
+// Relabels the component in increasing vertex order, which keeps the
+// neighbor lists sorted, as the binary searches of SparseMISS need.
+void ComponentMISS::SolveComponent(vector<vector<int>> const &adjacencyArray, vector<int> const &vComponent, vector<int> &vLocalIndex, list<int> &independentSet)
+{
+    for (size_t index = 0; index < vComponent.size(); ++index) {
+        vLocalIndex[vComponent[index]] = index;
+    }
+
+    vector<vector<int>> vLocalAdjacencyArray(vComponent.size());
+    for (size_t index = 0; index < vComponent.size(); ++index) {
+        for (int const neighbor : adjacencyArray[vComponent[index]]) {
+            vLocalAdjacencyArray[index].push_back(vLocalIndex[neighbor]);
+        }
+    }
+
+    Algorithm *pSolver(m_CreateComponentAlgorithm(vLocalAdjacencyArray));
+    pSolver->SetQuiet(true);
+    pSolver->SetSearchLimits(GetSearchLimits());
+
+    list<list<int>> componentSets;
+    pSolver->Run(componentSets);
+    m_uNodeCount += pSolver->GetNodeCount();
+
+    if (GetSearchLimits() != nullptr && GetSearchLimits()->Stopped()) {
+        m_uUpperBound += pSolver->GetUpperBound();
+        m_uNumUnsolved++;
+    } else {
+        m_uUpperBound += componentSets.back().size();
+    }
+
+    if (!componentSets.empty()) {
+        for (int const localVertex : componentSets.back()) {
+            independentSet.push_back(vComponent[localVertex]);
+        }
+    }
+
+    delete pSolver; pSolver = nullptr;
+}
+
+// checked between components too, as small ones finish before their first check.
+bool ComponentMISS::SearchLimitReached() const
+{
+    return GetSearchLimits() != nullptr && GetSearchLimits()->Check(0);
+}
@@ -0,0 +1,64 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef COMPONENT_MISS_H
+#define COMPONENT_MISS_H
+
+#include "Algorithm.h"
+#include "IndependentSetReductions.h"
+
+#include <vector>
+#include <list>
+#include <string>
+#include <functional>
+#include <ctime>
+
+// Maximum independent set by reducing the graph with IndependentSetReductions,
+// and solving each connected component of the kernel on its own, smallest
+// first, with the algorithm createComponentAlgorithm returns for its
+// adjacency array (which outlives it). The union of these is lifted back to
+// the graph. sparse-miss uses SparseMISS, so that it never needs the dense
+// complement, and --reduce the matrix algorithms.
+class ComponentMISS : public Algorithm
+{
+public:
+    ComponentMISS(std::string const &name, std::vector<std::vector<int>> const &adjacencyArray, std::function<Algorithm*(std::vector<std::vector<int>> const &)> createComponentAlgorithm);
+    virtual ~ComponentMISS();
+
+    virtual long Run(std::list<std::list<int>> &cliques);
+
+    virtual size_t GetUpperBound() const { return m_uUpperBound; }
+
+    virtual size_t GetNodeCount() const { return m_uNodeCount; }
+    virtual double GetTimeToLargestCliqueInSeconds() const { return static_cast<double>(m_TimeToLargestClique)/CLOCKS_PER_SEC; }
+
+protected:
+    void ComputeComponents(std::vector<std::vector<int>> const &adjacencyArray, std::vector<std::vector<int>> &vComponents) const;
+    void SolveComponent(std::vector<std::vector<int>> const &adjacencyArray, std::vector<int> const &vComponent, std::vector<int> &vLocalIndex, std::list<int> &independentSet);
+
+    bool SearchLimitReached() const;
+
+    IndependentSetReductions m_Reductions;
+    std::function<Algorithm*(std::vector<std::vector<int>> const &)> m_CreateComponentAlgorithm;
+    size_t  m_uNumComponents;
+    size_t  m_uLargestComponent;
+    size_t  m_uNumUnsolved;     // components skipped once a search limit was reached
+    size_t  m_uNodeCount;
+    size_t  m_uUpperBound;
+    clock_t m_StartTime;
+    clock_t m_TimeToLargestClique;
+};
+
+#endif //COMPONENT_MISS_H
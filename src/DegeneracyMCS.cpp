@@ -0,0 +1,273 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "DegeneracyMCS.h"
+#include "DegeneracyTools.h"
+#include "GraphTools.h"
+#include "BitSetMCS.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <thread>
+
+using namespace std;
+
+DegeneracyMCS::DegeneracyMCS(vector<vector<int>> &adjacencyArray, int const numThreads)
+: Algorithm("degeneracy-mcs")
+, m_AdjacencyArray(adjacencyArray)
+, m_vLaterNeighborsOf()
+, m_iNumThreads(max(numThreads, 1))
+, m_uDegeneracy(0)
+, m_uMaximumCliqueSize(0)
+, m_uNumSolved(0)
+, m_uNodeCount(0)
+, m_uUnsolvedBound(0)
+, m_CliqueMutex()
+, m_StartTime(clock())
+, m_TimeToLargestClique(0)
+{
+}
+
+DegeneracyMCS::~DegeneracyMCS()
+{
+    if (!GetQuiet()) {
+        cerr << "Threads            : " << m_iNumThreads << endl;
+        cerr << "Degeneracy         : " << m_uDegeneracy << endl;
+        cerr << "Largest Clique     : " << m_uMaximumCliqueSize.load() << endl;
+        cerr << "Subproblems Solved : " << m_uNumSolved.load() << endl;
+        cerr << "Subproblems Skipped: " << m_vLaterNeighborsOf.size() - m_uNumSolved.load() << endl;
+        cerr << "Search Nodes       : " << m_uNodeCount.load() << endl;
+    }
+}
+
+long DegeneracyMCS::Run(list<list<int>> &cliques)
+{
+    int const size(m_AdjacencyArray.size());
+
+    cliques.push_back(list<int>());
+    if (size == 0) return cliques.size();
+
+    vector<NeighborListArray> vOrderingArray(computeDegeneracyOrderArray(m_AdjacencyArray, size));
+
+    vector<int> vVertexOrder(size);
+    m_vLaterNeighborsOf.resize(size);
+    for (NeighborListArray &neighborList : vOrderingArray) {
+        vVertexOrder[neighborList.orderNumber] = neighborList.vertex;
+        m_vLaterNeighborsOf[neighborList.vertex].swap(neighborList.later);
+        m_uDegeneracy = max(m_uDegeneracy, static_cast<size_t>(neighborList.laterDegree));
+    }
+    vector<NeighborListArray>().swap(vOrderingArray);
+
+    // visit vertices with the most later neighbors first, in degeneracy
+    // order otherwise, so that a large clique is found early and the bound
+    // skips most of the remaining vertices.
+    vector<vector<int>> vVerticesByLaterDegree(m_uDegeneracy + 1);
+    for (int const vertex : vVertexOrder) {
+        vVerticesByLaterDegree[m_vLaterNeighborsOf[vertex].size()].push_back(vertex);
+    }
+
+    vVertexOrder.clear();
+    for (size_t laterDegree = m_uDegeneracy + 1; laterDegree > 0; --laterDegree) {
+        vVertexOrder.insert(vVertexOrder.end(), vVerticesByLaterDegree[laterDegree-1].begin(), vVerticesByLaterDegree[laterDegree-1].end());
+    }
+    vector<vector<int>>().swap(vVerticesByLaterDegree);
+
+    // any vertex is a clique.
+    cliques.back().push_back(vVertexOrder.front());
+    m_uMaximumCliqueSize = 1;
+    RecordTimeOfLargestClique();
+
+    if (m_iNumThreads > 1) {
+        RunPipeline(vVertexOrder, cliques.back());
+    } else {
+        RunSerial(vVertexOrder, cliques.back());
+    }
+
+    ExecuteCallBacks(cliques.back());
+
+    return cliques.size();
+}
+
+void DegeneracyMCS::ExtractSubproblem(int const vertex, vector<int> &vLocalIndex, Subproblem &subproblem) const
+{
+    // an edge between two later neighbors is in the later list of whichever
+    // comes first, so those lists are enough to build the subgraph.
+    subproblem.vertex = vertex;
+    GraphTools::ComputeInducedSubgraph(m_vLaterNeighborsOf, m_vLaterNeighborsOf[vertex], vLocalIndex, subproblem.vAdjacencyMatrix);
+}
+
+// Look for a clique containing the subproblem's vertex, larger than the
+// largest one found so far.
+void DegeneracyMCS::SolveSubproblem(Subproblem const &subproblem, list<int> &largestClique)
+{
+    m_uNumSolved++;
+
+    size_t const uMaximumCliqueSize(m_uMaximumCliqueSize.load());
+    vector<int> const &vLaterNeighbors(m_vLaterNeighborsOf[subproblem.vertex]);
+
+    // the vertex and its later neighbor, if it has one, is the largest
+    // clique; too small a subproblem for BitSetMCS.
+    if (vLaterNeighbors.size() <= 1) {
+        if (vLaterNeighbors.size() + 1 <= uMaximumCliqueSize) return;
+        list<int> clique(1, subproblem.vertex);
+        clique.insert(clique.end(), vLaterNeighbors.begin(), vLaterNeighbors.end());
+        RecordClique(clique, largestClique);
+        return;
+    }
+
+    BitSetMCS solver(subproblem.vAdjacencyMatrix);
+    solver.SetMaximumCliqueSize(uMaximumCliqueSize - 1);
+    solver.SetSearchLimits(GetSearchLimits());
+
+    list<list<int>> subproblemCliques;
+    solver.Run(subproblemCliques);
+    m_uNodeCount += solver.GetNodeCount();
+
+    if (solver.GetSearchStopped()) {
+        RecordUnsolved(solver.GetUpperBound() + 1);
+    }
+
+    if (subproblemCliques.empty() || subproblemCliques.back().size() + 1 <= uMaximumCliqueSize) {
+        return;
+    }
+
+    list<int> clique;
+    clique.push_back(subproblem.vertex);
+    for (int const localVertex : subproblemCliques.back()) {
+        clique.push_back(vLaterNeighbors[localVertex]);
+    }
+
+    RecordClique(clique, largestClique);
+}
+
+void DegeneracyMCS::RecordClique(list<int> &clique, list<int> &largestClique)
+{
+    lock_guard<mutex> lock(m_CliqueMutex);
+    if (clique.size() > m_uMaximumCliqueSize.load()) {
+        m_uMaximumCliqueSize = clique.size();
+        m_TimeToLargestClique = clock() - m_StartTime;
+        RecordTimeOfLargestClique();
+        largestClique.swap(clique);
+    }
+}
+
+// checked between subproblems too, as small ones finish before their first check.
+bool DegeneracyMCS::SearchLimitReached() const
+{
+    return GetSearchLimits() != nullptr && GetSearchLimits()->Check(0);
+}
+
+void DegeneracyMCS::RecordUnsolved(size_t const uBound)
+{
+    size_t uUnsolvedBound(m_uUnsolvedBound.load());
+    while (uUnsolvedBound < uBound && !m_uUnsolvedBound.compare_exchange_weak(uUnsolvedBound, uBound)) {
+    }
+}
+
+void DegeneracyMCS::RunSerial(vector<int> const &vVertexOrder, list<int> &largestClique)
+{
+    vector<int> vLocalIndex(m_AdjacencyArray.size(), -1);
+    Subproblem subproblem;
+
+    for (int const vertex : vVertexOrder) {
+        // the degeneracy bound: at most all later neighbors join vertex, and
+        // no vertex after this one has more later neighbors.
+        if (!CanImprove(vertex)) break;
+
+        // so the later vertices are left unsolved, and bounded, too.
+        if (SearchLimitReached()) {
+            RecordUnsolved(m_vLaterNeighborsOf[vertex].size() + 1);
+            break;
+        }
+
+        ExtractSubproblem(vertex, vLocalIndex, subproblem);
+        SolveSubproblem(subproblem, largestClique);
+    }
+}
+
+// A quarter of the threads extract subproblems, in visit order, into a
+// bounded queue, and the others solve them. Extraction stops at the first
+// vertex that fails the degeneracy bound, as all later ones fail it too.
+void DegeneracyMCS::RunPipeline(vector<int> const &vVertexOrder, list<int> &largestClique)
+{
+    int const numExtractors(max(1, m_iNumThreads/4));
+    int const numSolvers(max(1, m_iNumThreads - numExtractors));
+    size_t const uQueueCapacity(4*numSolvers);
+
+    atomic<size_t> uNextIndex(0);
+    int iNumExtractorsRunning(numExtractors);
+    deque<Subproblem> queue;
+    mutex queueMutex;
+    condition_variable queueNotFull;
+    condition_variable queueNotEmpty;
+
+    auto extract = [&]() {
+        vector<int> vLocalIndex(m_AdjacencyArray.size(), -1);
+        Subproblem subproblem;
+        while (true) {
+            size_t const index(uNextIndex++);
+            if (index >= vVertexOrder.size() || !CanImprove(vVertexOrder[index])) break;
+            if (SearchLimitReached()) {
+                RecordUnsolved(m_vLaterNeighborsOf[vVertexOrder[index]].size() + 1);
+                break;
+            }
+
+            ExtractSubproblem(vVertexOrder[index], vLocalIndex, subproblem);
+
+            unique_lock<mutex> lock(queueMutex);
+            queueNotFull.wait(lock, [&]() { return queue.size() < uQueueCapacity; });
+            queue.push_back(move(subproblem));
+            queueNotEmpty.notify_one();
+        }
+
+        uNextIndex = vVertexOrder.size(); // stops the other extractors
+        lock_guard<mutex> lock(queueMutex);
+        iNumExtractorsRunning--;
+        queueNotEmpty.notify_all();
+    };
+
+    auto solve = [&]() {
+        Subproblem subproblem;
+        while (true) {
+            {
+                unique_lock<mutex> lock(queueMutex);
+                queueNotEmpty.wait(lock, [&]() { return !queue.empty() || iNumExtractorsRunning == 0; });
+                if (queue.empty()) break;
+                subproblem = move(queue.front());
+                queue.pop_front();
+                queueNotFull.notify_one();
+            }
+
+            // the incumbent may have grown while the subproblem was queued.
+            if (!CanImprove(subproblem.vertex)) continue;
+
+            if (SearchLimitReached()) {
+                RecordUnsolved(m_vLaterNeighborsOf[subproblem.vertex].size() + 1);
+            } else {
+                SolveSubproblem(subproblem, largestClique);
+            }
+        }
+    };
+
+    vector<thread> vThreads;
+    for (int index = 0; index < numExtractors; ++index) vThreads.push_back(thread(extract));
+    for (int index = 0; index < numSolvers; ++index)    vThreads.push_back(thread(solve));
+
+    for (thread &workerThread : vThreads) {
+        workerThread.join();
+    }
+}
@@ -0,0 +1,84 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef DEGENERACY_MCS_H
+#define DEGENERACY_MCS_H
+
+#include "Algorithm.h"
+
+#include <vector>
+#include <list>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <ctime>
+
+// Solves a large sparse graph as a stream of small dense problems: every
+// clique has an earliest vertex v in degeneracy order, and the rest of the
+// clique is among v's later neighbors, of which there are at most the
+// degeneracy. So each vertex's later neighborhood is extracted as an
+// adjacency matrix and solved with bitset-mcs, skipping vertices with too few
+// later neighbors to beat the largest clique found so far.
+//
+// With more than one thread, this is a two stage pipeline: extraction
+// threads build the subproblems, and solver threads solve them. Both stages
+// check the shared incumbent, so subproblems that can no longer beat it are
+// dropped before they are built or colored.
+class DegeneracyMCS : public Algorithm
+{
+public:
+    // the neighbor lists are reordered when computing the degeneracy order.
+    DegeneracyMCS(std::vector<std::vector<int>> &adjacencyArray, int const numThreads);
+    virtual ~DegeneracyMCS();
+
+    virtual long Run(std::list<std::list<int>> &cliques);
+
+    virtual size_t GetUpperBound() const { return std::max(m_uMaximumCliqueSize.load(), m_uUnsolvedBound.load()); }
+
+    virtual size_t GetNodeCount() const { return m_uNodeCount.load(); }
+    virtual double GetTimeToLargestCliqueInSeconds() const { return static_cast<double>(m_TimeToLargestClique)/CLOCKS_PER_SEC; }
+
+protected:
+    struct Subproblem
+    {
+        int vertex;
+        std::vector<std::vector<char>> vAdjacencyMatrix; // on vertex's later neighbors
+    };
+
+    bool CanImprove(int const vertex) const { return m_vLaterNeighborsOf[vertex].size() + 1 > m_uMaximumCliqueSize.load(std::memory_order_relaxed); }
+    void ExtractSubproblem(int const vertex, std::vector<int> &vLocalIndex, Subproblem &subproblem) const;
+    void SolveSubproblem(Subproblem const &subproblem, std::list<int> &largestClique);
+    void RecordClique(std::list<int> &clique, std::list<int> &largestClique);
+
+    bool SearchLimitReached() const;
+    void RecordUnsolved(size_t const uBound);
+
+    void RunSerial(std::vector<int> const &vVertexOrder, std::list<int> &largestClique);
+    void RunPipeline(std::vector<int> const &vVertexOrder, std::list<int> &largestClique);
+
+    std::vector<std::vector<int>> &m_AdjacencyArray;
+    std::vector<std::vector<int>> m_vLaterNeighborsOf;
+    int    m_iNumThreads;
+    size_t m_uDegeneracy;
+    std::atomic<size_t> m_uMaximumCliqueSize;
+    std::atomic<size_t> m_uNumSolved;
+    std::atomic<size_t> m_uNodeCount;
+    std::atomic<size_t> m_uUnsolvedBound; // bound on the subproblems left when a search limit was reached
+    std::mutex m_CliqueMutex; // guards the largest clique, while solving in parallel
+    clock_t m_StartTime;
+    clock_t m_TimeToLargestClique;
+};
+
+#endif //DEGENERACY_MCS_H
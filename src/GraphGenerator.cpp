@@ -0,0 +1,200 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "GraphGenerator.h"
+
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+
+// true with probability p, from the raw generator output.
+bool Flip(mt19937_64 &generator, double const p)
+{
+    if (p >= 1.0) return true;
+    if (p <= 0.0) return false;
+    return generator() < static_cast<uint64_t>(p*18446744073709551616.0 /* 2^64 */);
+}
+
+// k distinct random vertices, by a partial Fisher-Yates shuffle.
+vector<int> RandomVertices(mt19937_64 &generator, int const n, int const k)
+{
+    vector<int> vVertices(n);
+    for (int vertex = 0; vertex < n; ++vertex) vVertices[vertex] = vertex;
+    for (int index = 0; index < k; ++index) {
+        int const other(index + static_cast<int>(generator() % static_cast<uint64_t>(n - index)));
+        swap(vVertices[index], vVertices[other]);
+    }
+    vVertices.resize(k);
+    return vVertices;
+}
+
+void BuildGraph(vector<vector<char>> const &vAdjacencyMatrix, CSRGraph &graph)
+{
+    int const n(static_cast<int>(vAdjacencyMatrix.size()));
+    vector<int64_t> vOffsets(n + 1, 0);
+    vector<int32_t> vNeighbors;
+    for (int vertex = 0; vertex < n; ++vertex) {
+        for (int neighbor = 0; neighbor < n; ++neighbor) {
+            if (vAdjacencyMatrix[vertex][neighbor]) vNeighbors.push_back(neighbor);
+        }
+        vOffsets[vertex + 1] = vNeighbors.size();
+    }
+    graph.BuildFromOffsetsAndNeighbors(vOffsets, vNeighbors);
+}
+
+void AddEdge(vector<vector<char>> &vAdjacencyMatrix, int const u, int const v, char const value)
+{
+    vAdjacencyMatrix[u][v] = value;
+    vAdjacencyMatrix[v][u] = value;
+}
+
+vector<vector<char>> RandomMatrix(mt19937_64 &generator, int const n, double const p)
+{
+    vector<vector<char>> vAdjacencyMatrix(n, vector<char>(n, 0));
+    for (int u = 0; u < n; ++u) {
+        for (int v = u + 1; v < n; ++v) {
+            if (Flip(generator, p)) AddEdge(vAdjacencyMatrix, u, v, 1);
+        }
+    }
+    return vAdjacencyMatrix;
+}
+
+void Fail(string const &specification)
+{
+    fprintf(stderr, "ERROR: malformed graph specification %s, expected gnp:n:p[:seed], brock:n:p:k[:seed], or san:n:p:k[:seed]\n", specification.c_str());
+    exit(1);
+}
+
+}
+
+void GraphGenerator::RandomGraph(int const n, double const p, uint64_t const seed, CSRGraph &graph)
+{
+    mt19937_64 generator(seed);
+    BuildGraph(RandomMatrix(generator, n, p), graph);
+}
+
+void GraphGenerator::HiddenCliqueGraph(int const n, double const p, int const k, uint64_t const seed, CSRGraph &graph)
+{
+    mt19937_64 generator(seed);
+    vector<vector<char>> vAdjacencyMatrix(RandomMatrix(generator, n, p));
+    vector<int> const vClique(RandomVertices(generator, n, k));
+
+    vector<char> vbInClique(n, 0);
+    for (int const vertex : vClique) vbInClique[vertex] = 1;
+
+    for (int const vertex : vClique) {
+        // each clique edge that was not there already costs an edge outside the clique.
+        int numAdded(0);
+        for (int const other : vClique) {
+            if (other != vertex && !vAdjacencyMatrix[vertex][other]) {
+                AddEdge(vAdjacencyMatrix, vertex, other, 1);
+                numAdded++;
+            }
+        }
+
+        vector<int> vOutside;
+        for (int neighbor = 0; neighbor < n; ++neighbor) {
+            if (vAdjacencyMatrix[vertex][neighbor] && !vbInClique[neighbor]) vOutside.push_back(neighbor);
+        }
+
+        for (int removed = 0; removed < numAdded && !vOutside.empty(); ++removed) {
+            size_t const index(generator() % vOutside.size());
+            AddEdge(vAdjacencyMatrix, vertex, vOutside[index], 0);
+            vOutside[index] = vOutside.back();
+            vOutside.pop_back();
+        }
+    }
+
+    BuildGraph(vAdjacencyMatrix, graph);
+}
+
+void GraphGenerator::PartiteCliqueGraph(int const n, double const p, int const k, uint64_t const seed, CSRGraph &graph)
+{
+    mt19937_64 generator(seed);
+
+    vector<int> vPart(n);
+    for (int vertex = 0; vertex < n; ++vertex) {
+        vPart[vertex] = static_cast<int>(generator() % static_cast<uint64_t>(k));
+    }
+
+    // only edges between parts are allowed, so raise their probability to keep density p.
+    double const q(min(1.0, p/(1.0 - 1.0/k)));
+    vector<vector<char>> vAdjacencyMatrix(n, vector<char>(n, 0));
+    for (int u = 0; u < n; ++u) {
+        for (int v = u + 1; v < n; ++v) {
+            if (vPart[u] != vPart[v] && Flip(generator, q)) AddEdge(vAdjacencyMatrix, u, v, 1);
+        }
+    }
+
+    // parts are random, so pick the clique's vertex in each part among the shuffled vertices.
+    vector<int> const vShuffled(RandomVertices(generator, n, n));
+    vector<int> vClique(k, -1);
+    for (int const vertex : vShuffled) {
+        if (vClique[vPart[vertex]] == -1) vClique[vPart[vertex]] = vertex;
+    }
+
+    for (int const u : vClique) {
+        for (int const v : vClique) {
+            if (u != -1 && v != -1 && u != v) AddEdge(vAdjacencyMatrix, u, v, 1);
+        }
+    }
+
+    BuildGraph(vAdjacencyMatrix, graph);
+}
+
+bool GraphGenerator::IsSpecification(string const &specification)
+{
+    return specification.compare(0, 4, "gnp:") == 0 || specification.compare(0, 6, "brock:") == 0 || specification.compare(0, 4, "san:") == 0;
+}
+
+void GraphGenerator::Generate(string const &specification, CSRGraph &graph)
+{
+    vector<string> vFields;
+    size_t start(0);
+    while (true) {
+        size_t const end(specification.find(':', start));
+        vFields.push_back(specification.substr(start, end - start));
+        if (end == string::npos) break;
+        start = end + 1;
+    }
+
+    string const &type(vFields[0]);
+    size_t const numParameters(type == "gnp" ? 2 : 3);
+    if (vFields.size() != numParameters + 1 && vFields.size() != numParameters + 2) Fail(specification);
+
+    int    const n(atoi(vFields[1].c_str()));
+    double const p(atof(vFields[2].c_str()));
+    int    const k(type == "gnp" ? 0 : atoi(vFields[3].c_str()));
+    uint64_t const seed(vFields.size() == numParameters + 2 ? strtoull(vFields.back().c_str(), nullptr, 10) : 1);
+
+    if (n < 1 || p < 0.0 || p > 1.0 || (type != "gnp" && (k < 1 || k > n))) Fail(specification);
+
+    if (type == "gnp") {
+        RandomGraph(n, p, seed, graph);
+    } else if (type == "brock") {
+        HiddenCliqueGraph(n, p, k, seed, graph);
+    } else if (type == "san") {
+        PartiteCliqueGraph(n, p, k, seed, graph);
+    } else {
+        Fail(specification);
+    }
+}
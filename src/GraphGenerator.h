@@ -0,0 +1,47 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef GRAPH_GENERATOR_H
+#define GRAPH_GENERATOR_H
+
+#include "CSRGraph.h"
+
+#include <string>
+#include <cstdint>
+
+// Synthetic instances for benchmarking, so that no data files are needed.
+// The generators draw from a 64-bit Mersenne Twister, and only use its raw
+// output, so that a seed gives the same graph with any standard library.
+namespace GraphGenerator
+{
+    // G(n,p): each edge is present with probability p.
+    void RandomGraph(int const n, double const p, uint64_t const seed, CSRGraph &graph);
+
+    // like the brock instances: G(n,p) with a clique of size k hidden on
+    // random vertices, whose other edges are thinned so that their degrees
+    // do not give the clique away.
+    void HiddenCliqueGraph(int const n, double const p, int const k, uint64_t const seed, CSRGraph &graph);
+
+    // like the san instances: a random k-partite graph of density about p,
+    // with a clique of one vertex from each part, so the clique number is k.
+    void PartiteCliqueGraph(int const n, double const p, int const k, uint64_t const seed, CSRGraph &graph);
+
+    // generator specifications are gnp:n:p[:seed], brock:n:p:k[:seed], and
+    // san:n:p:k[:seed]; exits with an error on a malformed specification.
+    bool IsSpecification(std::string const &specification);
+    void Generate(std::string const &specification, CSRGraph &graph);
+};
+
+#endif //GRAPH_GENERATOR_H
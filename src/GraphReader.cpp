@@ -0,0 +1,627 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "GraphReader.h"
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <initializer_list>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+
+// A read-only mapping of a whole file.
+class MappedFile
+{
+public:
+    MappedFile(string const &fileName) : m_pData(nullptr), m_uSize(0)
+    {
+        int const fileDescriptor(open(fileName.c_str(), O_RDONLY));
+        if (fileDescriptor < 0) {
+            fprintf(stderr, "ERROR: Unable to open file %s\n", fileName.c_str());
+            exit(1);
+        }
+
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) != 0) {
+            fprintf(stderr, "ERROR: Unable to read file %s\n", fileName.c_str());
+            exit(1);
+        }
+
+        m_uSize = fileStats.st_size;
+        if (m_uSize > 0) {
+            void *pData(mmap(nullptr, m_uSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0));
+            if (pData == MAP_FAILED) {
+                fprintf(stderr, "ERROR: Unable to map file %s\n", fileName.c_str());
+                exit(1);
+            }
+            m_pData = static_cast<char const*>(pData);
+            madvise(pData, m_uSize, MADV_SEQUENTIAL);
+        }
+        close(fileDescriptor);
+    }
+
+    ~MappedFile()
+    {
+        if (m_pData != nullptr) munmap(const_cast<char*>(m_pData), m_uSize);
+    }
+
+    char const *Begin() const { return m_pData; }
+    char const *End()   const { return m_pData + m_uSize; }
+    size_t      Size()  const { return m_uSize; }
+
+private:
+    char const *m_pData;
+    size_t      m_uSize;
+};
+
+// The first parse error in a chunk, with its line relative to the chunk.
+class ParseError
+{
+public:
+    ParseError() : bFound(false), kind(NONE), line(0), u(0), v(0) {}
+
+    enum Kind { NONE, LOOP, OUT_OF_RANGE, BAD_CHARACTER, BAD_LINE };
+
+    void Set(Kind const newKind, size_t const newLine, long long const newU, long long const newV)
+    {
+        if (bFound) return;
+        bFound = true; kind = newKind; line = newLine; u = newU; v = newV;
+    }
+
+    bool      bFound;
+    Kind      kind;
+    size_t    line;
+    long long u;
+    long long v;
+};
+
+class Chunk
+{
+public:
+    Chunk() : pBegin(nullptr), pEnd(nullptr), uNumLines(0), uNumCommentLines(0), uFirstLine(0), vDegrees(), vValues(), error() {}
+
+    char const *pBegin;
+    char const *pEnd;
+    size_t uNumLines;
+    size_t uNumCommentLines;    // METIS: comment lines, not counted in uNumLines
+    size_t uFirstLine;          // number of lines (or vertices) before this chunk
+    vector<int64_t> vDegrees;   // METIS: degree of each vertex in the chunk
+    vector<int32_t> vValues;    // METIS: neighbors, edges: u,v pairs
+    ParseError error;
+};
+
+template <typename Function>
+void ParallelFor(size_t const count, int const numThreads, Function function)
+{
+    if (numThreads <= 1 || count <= 1) {
+        for (size_t index = 0; index < count; ++index) function(index);
+        return;
+    }
+
+    vector<thread> vThreads;
+    for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        vThreads.push_back(thread([threadIndex, numThreads, count, &function]() {
+            for (size_t index = threadIndex; index < count; index += numThreads) {
+                function(index);
+            }
+        }));
+    }
+
+    for (thread &workerThread : vThreads) {
+        workerThread.join();
+    }
+}
+
+inline bool IsSpace(char const c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool IsDigit(char const c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// scans an optionally negative integer, p must point to '-' or a digit.
+inline long long ScanInteger(char const *&p, char const *pEnd)
+{
+    bool const bNegative(*p == '-');
+    if (bNegative) ++p;
+    long long value(0);
+    while (p < pEnd && IsDigit(*p)) {
+        value = value*10 + (*p - '0');
+        ++p;
+    }
+    return bNegative ? -value : value;
+}
+
+inline char const *EndOfLine(char const *p, char const *pEnd)
+{
+    char const *pNewLine(static_cast<char const*>(memchr(p, '\n', pEnd - p)));
+    return (pNewLine == nullptr) ? pEnd : pNewLine;
+}
+
+// Reads "n m" from the first line that is neither empty nor a comment.
+// Returns the position after that line.
+char const *ReadHeader(char const *p, char const *pEnd, long long &n, long long &m, string const &fileName)
+{
+    while (p < pEnd) {
+        char const *pLineEnd(EndOfLine(p, pEnd));
+        char const *q(p);
+        while (q < pLineEnd && IsSpace(*q)) ++q;
+        if (q < pLineEnd && *q != '%') {
+            long long values[2] = {-1, -1};
+            for (int index = 0; index < 2; ++index) {
+                while (q < pLineEnd && IsSpace(*q)) ++q;
+                if (q < pLineEnd && (IsDigit(*q) || *q == '-')) values[index] = ScanInteger(q, pLineEnd);
+            }
+            n = values[0]; m = values[1];
+            if (n < 0 || m < 0) break;
+            return (pLineEnd < pEnd) ? pLineEnd + 1 : pEnd;
+        }
+        p = (pLineEnd < pEnd) ? pLineEnd + 1 : pEnd;
+    }
+
+    fprintf(stderr, "ERROR: Problem reading number of vertices and edges in file %s\n", fileName.c_str());
+    exit(1);
+    return pEnd;
+}
+
+// Splits [pBegin, pEnd) into pieces that start at the beginning of a line.
+vector<Chunk> SplitIntoChunks(char const *pBegin, char const *pEnd, size_t const numChunks)
+{
+    vector<Chunk> vChunks;
+    size_t const uSize(pEnd - pBegin);
+    char const *pChunkBegin(pBegin);
+    for (size_t index = 1; index <= numChunks && pChunkBegin < pEnd; ++index) {
+        char const *pChunkEnd((index == numChunks) ? pEnd : pBegin + (uSize*index)/numChunks);
+        if (pChunkEnd < pChunkBegin) pChunkEnd = pChunkBegin;
+        if (pChunkEnd < pEnd) {
+            pChunkEnd = EndOfLine(pChunkEnd, pEnd);
+            if (pChunkEnd < pEnd) ++pChunkEnd;
+        }
+        vChunks.push_back(Chunk());
+        vChunks.back().pBegin = pChunkBegin;
+        vChunks.back().pEnd   = pChunkEnd;
+        pChunkBegin = pChunkEnd;
+    }
+    return vChunks;
+}
+
+inline bool IsCommentLine(char const *p, char const *pLineEnd)
+{
+    return p < pLineEnd && *p == '%';
+}
+
+// uFirstLine is the number of lines before the chunk, including the header.
+void ReportError(ParseError const &error, size_t const uFirstLine, string const &fileName)
+{
+    size_t const line(uFirstLine + error.line + 1);
+    switch (error.kind) {
+        case ParseError::LOOP:
+            fprintf(stderr, "ERROR: Detected loop %lld->%lld on line %zu of file %s\n", error.u, error.v, line, fileName.c_str());
+            break;
+        case ParseError::OUT_OF_RANGE:
+            fprintf(stderr, "ERROR: Vertex %lld is out of range on line %zu of file %s\n", error.v, line, fileName.c_str());
+            break;
+        case ParseError::BAD_CHARACTER:
+            fprintf(stderr, "ERROR: Unexpected character on line %zu of file %s\n", line, fileName.c_str());
+            break;
+        default:
+            fprintf(stderr, "ERROR: Problem reading line %zu of file %s\n", line, fileName.c_str());
+            break;
+    }
+    exit(1);
+}
+
+void ReportFirstError(vector<Chunk> const &vChunks, size_t const uNumHeaderLines, string const &fileName)
+{
+    size_t uNumCommentLines(0);
+    for (Chunk const &chunk : vChunks) {
+        if (chunk.error.bFound) ReportError(chunk.error, uNumHeaderLines + chunk.uFirstLine + uNumCommentLines, fileName);
+        uNumCommentLines += chunk.uNumCommentLines;
+    }
+}
+
+size_t CountLines(char const *pBegin, char const *pEnd)
+{
+    return count(pBegin, pEnd, '\n');
+}
+
+// sorts and removes duplicates from each neighbor range, compacting in place.
+void SortAndCompact(vector<int64_t> &vOffsets, vector<int32_t> &vNeighbors, int const numThreads)
+{
+    size_t const numVertices(vOffsets.size() - 1);
+    vector<int64_t> vNewDegrees(numVertices, 0);
+    size_t const verticesPerBlock(max(static_cast<size_t>(1), numVertices/(4*max(numThreads, 1)) + 1));
+    size_t const numBlocks((numVertices + verticesPerBlock - 1)/verticesPerBlock);
+
+    ParallelFor(numBlocks, numThreads, [&](size_t const block) {
+        size_t const uEnd(min(numVertices, (block+1)*verticesPerBlock));
+        for (size_t vertex = block*verticesPerBlock; vertex < uEnd; ++vertex) {
+            int32_t *pBegin(vNeighbors.data() + vOffsets[vertex]);
+            int32_t *pEnd(vNeighbors.data() + vOffsets[vertex+1]);
+            sort(pBegin, pEnd);
+            vNewDegrees[vertex] = unique(pBegin, pEnd) - pBegin;
+        }
+    });
+
+    size_t uWrite(0);
+    for (size_t vertex = 0; vertex < numVertices; ++vertex) {
+        int64_t const uRead(vOffsets[vertex]);
+        vOffsets[vertex] = uWrite;
+        if (static_cast<int64_t>(uWrite) != uRead) {
+            memmove(vNeighbors.data() + uWrite, vNeighbors.data() + uRead, vNewDegrees[vertex]*sizeof(int32_t));
+        }
+        uWrite += vNewDegrees[vertex];
+    }
+    vOffsets[numVertices] = uWrite;
+    vNeighbors.resize(uWrite);
+}
+
+// Builds the CSR graph from the first uNumEdges u,v pairs in the chunks.
+void BuildFromEdgeChunks(vector<Chunk> &vChunks, long long const n, size_t const uNumEdges, bool const bothDirections, CSRGraph &graph, int const numThreads)
+{
+    vector<int64_t> vOffsets(n + 1, 0);
+    {
+        size_t uEdgesLeft(uNumEdges);
+        for (Chunk const &chunk : vChunks) {
+            for (size_t index = 0; index < chunk.vValues.size() && uEdgesLeft > 0; index += 2, --uEdgesLeft) {
+                vOffsets[chunk.vValues[index] + 1]++;
+                if (bothDirections) vOffsets[chunk.vValues[index+1] + 1]++;
+            }
+        }
+        for (long long vertex = 0; vertex < n; ++vertex) {
+            vOffsets[vertex+1] += vOffsets[vertex];
+        }
+    }
+
+    vector<int32_t> vNeighbors(vOffsets[n]);
+    {
+        vector<int64_t> vNextSlot(vOffsets.begin(), vOffsets.end() - 1);
+        size_t uEdgesLeft(uNumEdges);
+        for (Chunk &chunk : vChunks) {
+            for (size_t index = 0; index < chunk.vValues.size() && uEdgesLeft > 0; index += 2, --uEdgesLeft) {
+                int32_t const u(chunk.vValues[index]), v(chunk.vValues[index+1]);
+                vNeighbors[vNextSlot[u]++] = v;
+                if (bothDirections) vNeighbors[vNextSlot[v]++] = u;
+            }
+            vector<int32_t>().swap(chunk.vValues);
+        }
+    }
+
+    SortAndCompact(vOffsets, vNeighbors, numThreads);
+
+    graph.BuildFromOffsetsAndNeighbors(vOffsets, vNeighbors);
+}
+
+}
+
+size_t GraphReader::ReadMETIS(string const &fileName, CSRGraph &graph, int const numThreads)
+{
+    MappedFile file(fileName);
+
+    long long n(0), m(0);
+    char const *pData(ReadHeader(file.Begin(), file.End(), n, m, fileName));
+
+    vector<Chunk> vChunks(SplitIntoChunks(pData, file.End(), 4*max(numThreads, 1)));
+
+    // first pass: count vertex lines, to find the first vertex of each chunk.
+    ParallelFor(vChunks.size(), numThreads, [&vChunks](size_t const index) {
+        Chunk &chunk(vChunks[index]);
+        for (char const *p = chunk.pBegin; p < chunk.pEnd;) {
+            char const *pLineEnd(EndOfLine(p, chunk.pEnd));
+            if (IsCommentLine(p, pLineEnd)) {
+                chunk.uNumCommentLines++;
+            } else {
+                chunk.uNumLines++;
+            }
+            p = pLineEnd + 1;
+        }
+    });
+
+    size_t const uNumHeaderLines(CountLines(file.Begin(), pData));
+    size_t uNumLines(0);
+    size_t uNumCommentLines(0);
+    for (Chunk &chunk : vChunks) {
+        chunk.uFirstLine = uNumLines;
+        uNumLines += chunk.uNumLines;
+        uNumCommentLines += chunk.uNumCommentLines;
+    }
+
+    if (uNumLines < static_cast<size_t>(n)) {
+        fprintf(stderr, "ERROR: Problem reading line %zu in file %s\n", uNumHeaderLines + uNumLines + uNumCommentLines + 1, fileName.c_str());
+        exit(1);
+    }
+
+    // second pass: parse neighbors, line i (0-based) lists neighbors of vertex i.
+    // errors are reported on the line in the file, which counts comments.
+    ParallelFor(vChunks.size(), numThreads, [&vChunks, n](size_t const index) {
+        Chunk &chunk(vChunks[index]);
+        size_t line(0);
+        size_t fileLine(0);
+        for (char const *p = chunk.pBegin; p < chunk.pEnd && chunk.uFirstLine + line < static_cast<size_t>(n); ++fileLine) {
+            char const *pLineEnd(EndOfLine(p, chunk.pEnd));
+            if (IsCommentLine(p, pLineEnd)) {
+                p = pLineEnd + 1;
+                continue;
+            }
+
+            long long const u(chunk.uFirstLine + line);
+            size_t const uFirstNeighbor(chunk.vValues.size());
+            while (p < pLineEnd) {
+                if (IsSpace(*p)) {
+                    ++p;
+                } else if (IsDigit(*p) || *p == '-') {
+                    long long const v(ScanInteger(p, pLineEnd) - 1);
+                    if (v < 0 || v >= n) {
+                        chunk.error.Set(ParseError::OUT_OF_RANGE, fileLine, u+1, v+1);
+                    } else if (u == v) {
+                        chunk.error.Set(ParseError::LOOP, fileLine, u+1, v+1);
+                    } else {
+                        chunk.vValues.push_back(static_cast<int32_t>(v));
+                    }
+                } else {
+                    chunk.error.Set(ParseError::BAD_CHARACTER, fileLine, u+1, 0);
+                    ++p;
+                }
+            }
+
+            chunk.vDegrees.push_back(chunk.vValues.size() - uFirstNeighbor);
+            line++;
+            p = pLineEnd + 1;
+        }
+    });
+
+    ReportFirstError(vChunks, uNumHeaderLines, fileName);
+
+    vector<int64_t> vOffsets(n + 1, 0);
+    {
+        size_t vertex(0);
+        for (Chunk const &chunk : vChunks) {
+            for (int64_t const degree : chunk.vDegrees) {
+                vOffsets[vertex+1] = vOffsets[vertex] + degree;
+                vertex++;
+            }
+        }
+    }
+
+    vector<int32_t> vNeighbors(vOffsets[n]);
+    ParallelFor(vChunks.size(), numThreads, [&vChunks, &vOffsets, &vNeighbors](size_t const index) {
+        Chunk &chunk(vChunks[index]);
+        if (chunk.vDegrees.empty()) return;
+        copy(chunk.vValues.begin(), chunk.vValues.end(), vNeighbors.begin() + vOffsets[chunk.uFirstLine]);
+        vector<int32_t>().swap(chunk.vValues);
+    });
+
+    SortAndCompact(vOffsets, vNeighbors, numThreads);
+
+    graph.BuildFromOffsetsAndNeighbors(vOffsets, vNeighbors);
+
+    return file.Size();
+}
+
+size_t GraphReader::ReadEdges(string const &fileName, CSRGraph &graph, int const numThreads)
+{
+    MappedFile file(fileName);
+
+    // n and m may be on separate lines.
+    long long n(-1), m(-1);
+    char const *p(file.Begin());
+    for (long long *pValue : {&n, &m}) {
+        while (p < file.End() && !IsDigit(*p) && *p != '-') ++p;
+        if (p < file.End()) *pValue = ScanInteger(p, file.End());
+    }
+
+    if (n < 0 || m < 0) {
+        fprintf(stderr, "problem with line 1 in input file\n");
+        exit(1);
+    }
+
+    char const *pData((p < file.End()) ? EndOfLine(p, file.End()) : file.End());
+    if (pData < file.End()) ++pData;
+
+    vector<Chunk> vChunks(SplitIntoChunks(pData, file.End(), 4*max(numThreads, 1)));
+
+    // each non-empty line holds one edge u,v
+    ParallelFor(vChunks.size(), numThreads, [&vChunks, n](size_t const index) {
+        Chunk &chunk(vChunks[index]);
+        for (char const *p = chunk.pBegin; p < chunk.pEnd;) {
+            char const *pLineEnd(EndOfLine(p, chunk.pEnd));
+            long long values[2];
+            int numValues(0);
+            while (p < pLineEnd) {
+                if (IsDigit(*p) || *p == '-') {
+                    long long const value(ScanInteger(p, pLineEnd));
+                    if (numValues < 2) values[numValues] = value;
+                    numValues++;
+                } else {
+                    ++p;
+                }
+            }
+
+            if (numValues == 2) {
+                long long const u(values[0]), v(values[1]);
+                if (u < 0 || u >= n) {
+                    chunk.error.Set(ParseError::OUT_OF_RANGE, chunk.uNumLines, u, u);
+                } else if (v < 0 || v >= n) {
+                    chunk.error.Set(ParseError::OUT_OF_RANGE, chunk.uNumLines, u, v);
+                } else if (u == v) {
+                    chunk.error.Set(ParseError::LOOP, chunk.uNumLines, u, v);
+                } else {
+                    chunk.vValues.push_back(static_cast<int32_t>(u));
+                    chunk.vValues.push_back(static_cast<int32_t>(v));
+                }
+            } else if (numValues != 0) {
+                chunk.error.Set(ParseError::BAD_LINE, chunk.uNumLines, 0, 0);
+            }
+
+            chunk.uNumLines++;
+            p = pLineEnd + 1;
+        }
+    });
+
+    size_t const uNumHeaderLines(CountLines(file.Begin(), pData));
+    size_t uNumEdges(0);
+    size_t uNumLines(0);
+    for (Chunk &chunk : vChunks) {
+        chunk.uFirstLine = uNumLines;
+        uNumLines += chunk.uNumLines;
+        // only the first m edges are read, as in readInGraphAdjList
+        if (uNumEdges < static_cast<size_t>(m)) {
+            if (chunk.error.bFound) ReportError(chunk.error, uNumHeaderLines + chunk.uFirstLine, fileName);
+        }
+        uNumEdges += chunk.vValues.size()/2;
+    }
+
+    if (uNumEdges < static_cast<size_t>(m)) {
+        fprintf(stderr, "problem with line %zu in input file\n", uNumEdges + 2);
+        exit(1);
+    }
+
+    BuildFromEdgeChunks(vChunks, n, m, false /* directed */, graph, numThreads);
+
+    return file.Size();
+}
+
+size_t GraphReader::ReadDIMACS(string const &fileName, CSRGraph &graph, int const numThreads)
+{
+    MappedFile file(fileName);
+
+    // the problem line "p edge n m" comes before the edges, after any comments.
+    long long n(-1), m(-1);
+    char const *pData(file.Begin());
+    while (pData < file.End() && n < 0) {
+        char const *pLineEnd(EndOfLine(pData, file.End()));
+        char const *p(pData);
+        while (p < pLineEnd && IsSpace(*p)) ++p;
+        if (p < pLineEnd && *p == 'p') {
+            for (long long *pValue : {&n, &m}) {
+                while (p < pLineEnd && !IsDigit(*p)) ++p;
+                if (p < pLineEnd) *pValue = ScanInteger(p, pLineEnd);
+            }
+            if (n < 0 || m < 0) {
+                fprintf(stderr, "ERROR: Problem reading problem line in file %s\n", fileName.c_str());
+                exit(1);
+            }
+        }
+        pData = (pLineEnd < file.End()) ? pLineEnd + 1 : file.End();
+    }
+
+    if (n < 0) {
+        fprintf(stderr, "ERROR: Missing problem line \"p edge <vertices> <edges>\" in file %s\n", fileName.c_str());
+        exit(1);
+    }
+
+    vector<Chunk> vChunks(SplitIntoChunks(pData, file.End(), 4*max(numThreads, 1)));
+
+    // edges are lines "e u v", with 1-based vertices; other lines are skipped.
+    ParallelFor(vChunks.size(), numThreads, [&vChunks, n](size_t const index) {
+        Chunk &chunk(vChunks[index]);
+        for (char const *p = chunk.pBegin; p < chunk.pEnd;) {
+            char const *pLineEnd(EndOfLine(p, chunk.pEnd));
+            while (p < pLineEnd && IsSpace(*p)) ++p;
+            if (p < pLineEnd && *p == 'e') {
+                ++p;
+                long long values[2];
+                int numValues(0);
+                while (p < pLineEnd && numValues < 2) {
+                    if (IsDigit(*p) || *p == '-') {
+                        values[numValues++] = ScanInteger(p, pLineEnd) - 1;
+                    } else {
+                        ++p;
+                    }
+                }
+
+                if (numValues != 2) {
+                    chunk.error.Set(ParseError::BAD_LINE, chunk.uNumLines, 0, 0);
+                } else {
+                    long long const u(values[0]), v(values[1]);
+                    if (u < 0 || u >= n) {
+                        chunk.error.Set(ParseError::OUT_OF_RANGE, chunk.uNumLines, u+1, u+1);
+                    } else if (v < 0 || v >= n) {
+                        chunk.error.Set(ParseError::OUT_OF_RANGE, chunk.uNumLines, u+1, v+1);
+                    } else if (u == v) {
+                        chunk.error.Set(ParseError::LOOP, chunk.uNumLines, u+1, v+1);
+                    } else {
+                        chunk.vValues.push_back(static_cast<int32_t>(u));
+                        chunk.vValues.push_back(static_cast<int32_t>(v));
+                    }
+                }
+            }
+
+            chunk.uNumLines++;
+            p = pLineEnd + 1;
+        }
+    });
+
+    size_t uNumLines(0);
+    size_t uNumEdges(0);
+    for (Chunk &chunk : vChunks) {
+        chunk.uFirstLine = uNumLines;
+        uNumLines += chunk.uNumLines;
+        uNumEdges += chunk.vValues.size()/2;
+    }
+
+    ReportFirstError(vChunks, CountLines(file.Begin(), pData), fileName);
+
+    // edges are listed once, or once in each direction; duplicates are removed.
+    BuildFromEdgeChunks(vChunks, n, uNumEdges, true /* add both directions */, graph, numThreads);
+
+    return file.Size();
+}
+
+string GraphReader::FormatForFile(string const &fileName)
+{
+    auto hasExtension = [&fileName](string const &extension) {
+        return fileName.size() >= extension.size() && fileName.compare(fileName.size() - extension.size(), extension.size(), extension) == 0;
+    };
+
+    if (CSRGraph::IsCSRFile(fileName)) return "csr";
+    if (hasExtension(".clq") || hasExtension(".dimacs") || hasExtension(".col")) return "dimacs";
+    if (fileName.find(".graph") != string::npos) return "metis";
+    return "edges";
+}
+
+size_t GraphReader::Read(string const &fileName, string const &format, CSRGraph &graph, int const numThreads)
+{
+    if (format == "csr") {
+        graph.Load(fileName);
+        return 0;
+    } else if (format == "metis") {
+        return ReadMETIS(fileName, graph, numThreads);
+    } else if (format == "dimacs") {
+        return ReadDIMACS(fileName, graph, numThreads);
+    } else if (format == "edges") {
+        return ReadEdges(fileName, graph, numThreads);
+    }
+
+    fprintf(stderr, "ERROR: unrecognized graph format %s\n", format.c_str());
+    exit(1);
+    return 0;
+}
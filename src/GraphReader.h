@@ -0,0 +1,51 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef GRAPH_READER_H
+#define GRAPH_READER_H
+
+#include "CSRGraph.h"
+
+#include <string>
+#include <cstddef>
+
+// Parallel readers for the text graph formats, which build a CSRGraph
+// directly. The file is mmap'd and split into line-aligned chunks, which are
+// parsed on separate threads. Like the iostream readers in Tools.cpp, they
+// exit with an error on self-loops and out-of-range vertices.
+//
+// Each returns the number of bytes parsed.
+namespace GraphReader
+{
+    // METIS format: a "n m" header line, then line i lists the (1-based)
+    // neighbors of vertex i. Lines starting with % are comments.
+    size_t ReadMETIS(std::string const &fileName, CSRGraph &graph, int const numThreads);
+
+    // edges format: n and m, then m lines "u,v" of (0-based) directed edges.
+    size_t ReadEdges(std::string const &fileName, CSRGraph &graph, int const numThreads);
+
+    // DIMACS format (.clq): "c" comment lines, a "p edge n m" problem line,
+    // then lines "e u v" of (1-based) undirected edges.
+    size_t ReadDIMACS(std::string const &fileName, CSRGraph &graph, int const numThreads);
+
+    // format name (metis, edges, dimacs, or csr) for a file, by its
+    // contents for csr, and otherwise by its extension.
+    std::string FormatForFile(std::string const &fileName);
+
+    // reads any supported format; csr files are mapped, not parsed.
+    size_t Read(std::string const &fileName, std::string const &format, CSRGraph &graph, int const numThreads);
+};
+
+#endif //GRAPH_READER_H
@@ -69,6 +69,36 @@ void GraphTools::ComputeInducedSubgraph(vector<vector<int>> const &graph, set<in
     }
 }
 
+// Same as above, but writes an adjacency matrix, where vertex i is
+// vertices[i]. Each edge only needs to be listed in one direction.
+// vLocalIndex is scratch space, with one -1 entry per vertex of the graph,
+// and is left that way.
+void GraphTools::ComputeInducedSubgraph(vector<vector<int>> const &graph, vector<int> const &vertices, vector<int> &vLocalIndex, vector<vector<char>> &adjacencyMatrix)
+{
+    int const numVertices(vertices.size());
+    for (int index = 0; index < numVertices; ++index) {
+        vLocalIndex[vertices[index]] = index;
+    }
+
+    adjacencyMatrix.resize(numVertices);
+    for (vector<char> &row : adjacencyMatrix) {
+        row.assign(numVertices, 0);
+    }
+
+    for (int index = 0; index < numVertices; ++index) {
+        for (int const neighbor : graph[vertices[index]]) {
+            int const neighborIndex(vLocalIndex[neighbor]);
+            if (neighborIndex == -1) continue;
+            adjacencyMatrix[index][neighborIndex] = 1;
+            adjacencyMatrix[neighborIndex][index] = 1;
+        }
+    }
+
+    for (int const vertex : vertices) {
+        vLocalIndex[vertex] = -1;
+    }
+}
+
 vector<int> GraphTools::OrderVerticesByDegree(vector<vector<int>> const &adjacencyList, bool const ascending)
 {
     vector<int> vOrderedVertices(adjacencyList.size(), -1);
@@ -26,6 +26,7 @@
 namespace GraphTools
 {
     void ComputeInducedSubgraph(std::vector<std::vector<int>> const &adjacencyList, std::set<int> const &vertices, std::vector<std::vector<int>> &subraph, std::map<int,int> &remapping);
+    void ComputeInducedSubgraph(std::vector<std::vector<int>> const &adjacencyList, std::vector<int> const &vertices, std::vector<int> &vLocalIndex, std::vector<std::vector<char>> &adjacencyMatrix);
     std::vector<int> OrderVerticesByDegree(std::vector<std::vector<int>> const &adjacencyList, bool const ascending);
     std::vector<int> OrderVerticesByDegree(ArraySet const &inGraph, std::vector<SparseArraySet> const &neighborSets, bool const ascending);
     std::vector<int> OrderVerticesByDegree(ArraySet const &inGraph, std::vector<ArraySet> const &neighborSets, bool const ascending);
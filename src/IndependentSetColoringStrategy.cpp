@@ -14,6 +14,7 @@
 */
 
 #include "IndependentSetColoringStrategy.h"
+#include "PerfCounters.h"
 #include "DegeneracyTools.h"
 
 #include <cmath>
@@ -312,6 +313,8 @@ int IndependentSetColoringStrategy::GetConflictingVertex(int const vertex, vecto
 
 bool IndependentSetColoringStrategy::Repair(int const vertex, int const color, int const iBestCliqueDelta)
 {
+    m_uRepairAttempts++;
+    PerfPhase const phase(PerfProfile::Active(), PerfProfile::Repair);
     for (int newColor = 0; newColor <= iBestCliqueDelta-1; newColor++) {
         int const conflictingVertex(GetConflictingVertex(vertex, m_vvVerticesWithColor[newColor]));
         if (conflictingVertex < 0) continue;
@@ -322,6 +325,7 @@ bool IndependentSetColoringStrategy::Repair(int const vertex, int const color, i
             m_vvVerticesWithColor[newColor].push_back(vertex);
             m_vvVerticesWithColor[nextColor].push_back(conflictingVertex);
 ////            cout << "Repairing vertices " << vertex << " and " << conflictingVertex << endl;
+            m_uRepairSuccesses++;
             return true;
         }
     }
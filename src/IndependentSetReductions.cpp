@@ -0,0 +1,456 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "IndependentSetReductions.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+IndependentSetReductions::IndependentSetReductions(vector<vector<int>> const &adjacencyArray)
+: m_uNumVertices(adjacencyArray.size())
+, m_InGraph(adjacencyArray.size())
+, m_Remaining(adjacencyArray.size())
+, m_vNeighbors(adjacencyArray)
+, m_vDegree(adjacencyArray.size(), 0)
+, m_vbMarked(adjacencyArray.size(), 0)
+, m_vTaken()
+, m_vFoldings()
+, m_uNumLowDegree(0)
+, m_uNumDegreeTwo(0)
+, m_uNumDominated(0)
+, m_uNumTwins(0)
+, m_uNumLP(0)
+{
+    for (size_t vertex = 0; vertex < m_uNumVertices; ++vertex) {
+        m_InGraph.Insert(vertex);
+        m_vDegree[vertex] = m_vNeighbors[vertex].size();
+    }
+}
+
+IndependentSetReductions::~IndependentSetReductions()
+{
+}
+
+void IndependentSetReductions::Reduce()
+{
+    size_t uSizeBefore(0);
+    do {
+        uSizeBefore = m_InGraph.Size();
+        for (int const vertex : m_InGraph) {
+            m_Remaining.Insert(vertex);
+        }
+
+        // a reduction puts the vertices around the ones it removes back in
+        // m_Remaining, as they may be reducible now.
+        while (!m_Remaining.Empty()) {
+            int const vertex(*m_Remaining.begin());
+            m_Remaining.Remove(vertex);
+
+            if (ReduceLowDegree(vertex)) continue;
+            if (ReduceDegreeTwo(vertex)) continue;
+            if (ReduceTwin(vertex))      continue;
+            ReduceDominated(vertex);
+        }
+
+        // the LP reduction looks at the whole graph, so it only runs once the
+        // local reductions are done.
+        ReduceLP();
+    } while (m_InGraph.Size() < uSizeBefore);
+}
+
+// the neighbors of vertex in the residual graph.
+vector<int> const &IndependentSetReductions::Neighbors(int const vertex)
+{
+    vector<int> &neighbors(m_vNeighbors[vertex]);
+    if (static_cast<int>(neighbors.size()) != m_vDegree[vertex]) {
+        neighbors.erase(remove_if(neighbors.begin(), neighbors.end(), [this](int const neighbor) { return !m_InGraph.Contains(neighbor); }), neighbors.end());
+    }
+    return neighbors;
+}
+
+void IndependentSetReductions::RemoveVertex(int const vertex)
+{
+    m_InGraph.Remove(vertex);
+    m_Remaining.Remove(vertex);
+    for (int const neighbor : m_vNeighbors[vertex]) {
+        if (!m_InGraph.Contains(neighbor)) continue;
+        m_vDegree[neighbor]--;
+        m_Remaining.Insert(neighbor);
+    }
+}
+
+void IndependentSetReductions::TakeVertex(int const vertex)
+{
+    m_vTaken.push_back(vertex);
+    RemoveVertex(vertex);
+    for (int const neighbor : m_vNeighbors[vertex]) {
+        if (m_InGraph.Contains(neighbor)) RemoveVertex(neighbor);
+    }
+}
+
+// Removes the alternatives and the others, and makes the representative
+// adjacent to the neighbors of the others. The alternatives must be adjacent
+// to exactly the representative and the others, which must be independent.
+void IndependentSetReductions::Fold(int const representative, vector<int> const &vOthers, vector<int> const &vAlternatives)
+{
+    Neighbors(representative);
+    m_vbMarked[representative] = 1;
+    for (int const neighbor : m_vNeighbors[representative]) m_vbMarked[neighbor] = 1;
+
+    for (int const alternative : vAlternatives) RemoveVertex(alternative);
+    for (int const other : vOthers) RemoveVertex(other);
+
+    for (int const other : vOthers) {
+        for (int const neighbor : m_vNeighbors[other]) {
+            if (m_vbMarked[neighbor] || !m_InGraph.Contains(neighbor)) continue;
+            m_vbMarked[neighbor] = 1;
+            m_vNeighbors[representative].push_back(neighbor);
+            m_vDegree[representative]++;
+            m_vNeighbors[neighbor].push_back(representative);
+            m_vDegree[neighbor]++;
+        }
+    }
+
+    m_vbMarked[representative] = 0;
+    for (int const neighbor : m_vNeighbors[representative]) {
+        m_vbMarked[neighbor] = 0;
+        if (m_InGraph.Contains(neighbor)) m_Remaining.Insert(neighbor);
+    }
+    m_Remaining.Insert(representative);
+
+    m_vFoldings.push_back(Folding{representative, vOthers, vAlternatives});
+}
+
+bool IndependentSetReductions::ReduceLowDegree(int const vertex)
+{
+    if (m_vDegree[vertex] > 1) return false;
+
+    m_uNumLowDegree++;
+    TakeVertex(vertex);
+    return true;
+}
+
+// A vertex with two adjacent neighbors is in some maximum independent set.
+// Otherwise, a maximum independent set has either the vertex or both of its
+// neighbors, so that folding them into one vertex lowers the independence
+// number by one.
+bool IndependentSetReductions::ReduceDegreeTwo(int const vertex)
+{
+    if (m_vDegree[vertex] != 2) return false;
+
+    vector<int> const &neighbors(Neighbors(vertex));
+    int representative(neighbors[0]);
+    int other(neighbors[1]);
+    if (m_vDegree[other] > m_vDegree[representative]) swap(representative, other);
+
+    vector<int> const &otherNeighbors(Neighbors(other));
+    bool const bAdjacent(find(otherNeighbors.begin(), otherNeighbors.end(), representative) != otherNeighbors.end());
+
+    m_uNumDegreeTwo++;
+    if (bAdjacent) {
+        TakeVertex(vertex);
+    } else {
+        Fold(representative, vector<int>(1, other), vector<int>(1, vertex));
+    }
+    return true;
+}
+
+// Two non-adjacent vertices of degree three with the same neighbors are both
+// in some maximum independent set if there is an edge between the neighbors.
+// Otherwise a maximum independent set has either both of them or all of the
+// neighbors, which are folded into one vertex, lowering the independence
+// number by two.
+bool IndependentSetReductions::ReduceTwin(int const vertex)
+{
+    if (m_vDegree[vertex] != 3) return false;
+
+    vector<int> const neighbors(Neighbors(vertex));
+    int smallest(neighbors[0]);
+    for (int const neighbor : neighbors) {
+        m_vbMarked[neighbor] = 1;
+        if (m_vDegree[neighbor] < m_vDegree[smallest]) smallest = neighbor;
+    }
+
+    // a twin is a neighbor of each of the neighbors, so look among the fewest.
+    int twin(-1);
+    for (int const candidate : Neighbors(smallest)) {
+        if (candidate == vertex || m_vDegree[candidate] != 3) continue;
+        vector<int> const &candidateNeighbors(Neighbors(candidate));
+        if (m_vbMarked[candidateNeighbors[0]] && m_vbMarked[candidateNeighbors[1]] && m_vbMarked[candidateNeighbors[2]]) {
+            twin = candidate;
+            break;
+        }
+    }
+
+    bool bHasEdge(false);
+    if (twin != -1) {
+        for (int const neighbor : neighbors) {
+            for (int const secondNeighbor : Neighbors(neighbor)) {
+                bHasEdge = bHasEdge || m_vbMarked[secondNeighbor];
+            }
+        }
+    }
+
+    for (int const neighbor : neighbors) m_vbMarked[neighbor] = 0;
+
+    if (twin == -1) return false;
+
+    m_uNumTwins++;
+    if (bHasEdge) {
+        TakeVertex(vertex);
+        TakeVertex(twin);
+    } else {
+        int representative(neighbors[0]);
+        for (int const neighbor : neighbors) {
+            if (m_vDegree[neighbor] > m_vDegree[representative]) representative = neighbor;
+        }
+        vector<int> vOthers;
+        for (int const neighbor : neighbors) {
+            if (neighbor != representative) vOthers.push_back(neighbor);
+        }
+        Fold(representative, vOthers, {vertex, twin});
+    }
+    return true;
+}
+
+// If N[vertex] is contained in N[neighbor], then some maximum independent
+// set does not have the neighbor, which is removed.
+bool IndependentSetReductions::ReduceDominated(int const vertex)
+{
+    vector<int> const &neighbors(Neighbors(vertex));
+    int const degree(m_vDegree[vertex]);
+
+    m_vbMarked[vertex] = 1;
+    size_t uSumOfDegrees(0);
+    for (int const neighbor : neighbors) {
+        m_vbMarked[neighbor] = 1;
+        uSumOfDegrees += m_vDegree[neighbor];
+    }
+
+    int dominated(-1);
+    for (int const neighbor : neighbors) {
+        if (m_vDegree[neighbor] < degree) continue;
+
+        bool bDominated(true);
+        if (static_cast<size_t>(m_vDegree[neighbor]) <= uSumOfDegrees) {
+            // count the shared vertices: the neighbor itself, and its marked neighbors.
+            int numShared(1);
+            for (int const secondNeighbor : Neighbors(neighbor)) {
+                numShared += m_vbMarked[secondNeighbor];
+            }
+            bDominated = (numShared == degree + 1);
+        } else {
+            // a high degree neighbor: look for it in the other neighbors' lists.
+            for (int const otherNeighbor : neighbors) {
+                if (otherNeighbor == neighbor) continue;
+                vector<int> const &otherNeighbors(Neighbors(otherNeighbor));
+                if (find(otherNeighbors.begin(), otherNeighbors.end(), neighbor) == otherNeighbors.end()) {
+                    bDominated = false;
+                    break;
+                }
+            }
+        }
+
+        if (bDominated) {
+            dominated = neighbor;
+            break;
+        }
+    }
+
+    m_vbMarked[vertex] = 0;
+    for (int const neighbor : neighbors) m_vbMarked[neighbor] = 0;
+
+    if (dominated == -1) return false;
+
+    m_uNumDominated++;
+    RemoveVertex(dominated);
+    return true;
+}
+
+// A half-integral optimum of the vertex cover LP is half a minimum vertex
+// cover of the bipartite double cover, with a left and a right copy of each
+// vertex, which is found from a maximum matching (Konig's theorem). Vertices
+// with both copies out of the cover are 0, and with both in are 1.
+bool IndependentSetReductions::ReduceLP()
+{
+    vector<int> const vVertices(m_InGraph.begin(), m_InGraph.end());
+    for (int const vertex : vVertices) Neighbors(vertex);
+
+    vector<int> vMatchLeft(m_uNumVertices, -1);
+    vector<int> vMatchRight(m_uNumVertices, -1);
+    for (int const left : vVertices) {
+        for (int const right : m_vNeighbors[left]) {
+            if (vMatchRight[right] != -1) continue;
+            vMatchLeft[left]   = right;
+            vMatchRight[right] = left;
+            break;
+        }
+    }
+
+    // Hopcroft-Karp: layer the left vertices by alternating paths from the
+    // free ones, then augment along the layers.
+    vector<int> vDistance(m_uNumVertices, -1);
+    vector<size_t> vNext(m_uNumVertices, 0);
+    vector<int> vQueue;
+    vector<int> vStack;
+    while (true) {
+        vQueue.clear();
+        for (int const left : vVertices) {
+            vDistance[left] = (vMatchLeft[left] == -1) ? 0 : -1;
+            if (vMatchLeft[left] == -1) vQueue.push_back(left);
+        }
+
+        bool bFoundFreeRight(false);
+        for (size_t index = 0; index < vQueue.size(); ++index) {
+            int const left(vQueue[index]);
+            for (int const right : m_vNeighbors[left]) {
+                int const nextLeft(vMatchRight[right]);
+                if (nextLeft == -1) {
+                    bFoundFreeRight = true;
+                } else if (vDistance[nextLeft] == -1) {
+                    vDistance[nextLeft] = vDistance[left] + 1;
+                    vQueue.push_back(nextLeft);
+                }
+            }
+        }
+
+        if (!bFoundFreeRight) break;
+
+        for (int const left : vVertices) vNext[left] = 0;
+
+        for (int const root : vVertices) {
+            if (vMatchLeft[root] != -1) continue;
+            vStack.assign(1, root);
+            while (!vStack.empty()) {
+                int const left(vStack.back());
+                vector<int> const &neighbors(m_vNeighbors[left]);
+                if (vNext[left] == neighbors.size()) {
+                    vDistance[left] = -1; // no augmenting path through it
+                    vStack.pop_back();
+                    continue;
+                }
+
+                int const right(neighbors[vNext[left]++]);
+                int const nextLeft(vMatchRight[right]);
+                if (nextLeft == -1) {
+                    for (int const pathLeft : vStack) {
+                        int const pathRight(m_vNeighbors[pathLeft][vNext[pathLeft]-1]);
+                        vMatchLeft[pathLeft]   = pathRight;
+                        vMatchRight[pathRight] = pathLeft;
+                    }
+                    vStack.clear();
+                } else if (vDistance[nextLeft] == vDistance[left] + 1) {
+                    vStack.push_back(nextLeft);
+                }
+            }
+        }
+    }
+
+    // the cover is the left copies not reachable from a free left vertex by
+    // an alternating path, and the right copies that are.
+    vector<char> vbLeftReached(m_uNumVertices, 0);
+    vector<char> vbRightReached(m_uNumVertices, 0);
+    vQueue.clear();
+    for (int const left : vVertices) {
+        if (vMatchLeft[left] != -1) continue;
+        vbLeftReached[left] = 1;
+        vQueue.push_back(left);
+    }
+
+    for (size_t index = 0; index < vQueue.size(); ++index) {
+        for (int const right : m_vNeighbors[vQueue[index]]) {
+            if (vbRightReached[right]) continue;
+            vbRightReached[right] = 1;
+            int const nextLeft(vMatchRight[right]);
+            if (!vbLeftReached[nextLeft]) {
+                vbLeftReached[nextLeft] = 1;
+                vQueue.push_back(nextLeft);
+            }
+        }
+    }
+
+    size_t const uSizeBefore(m_InGraph.Size());
+    for (int const vertex : vVertices) {
+        if (m_InGraph.Contains(vertex) && vbLeftReached[vertex] && !vbRightReached[vertex]) TakeVertex(vertex);
+    }
+
+    for (int const vertex : vVertices) {
+        if (m_InGraph.Contains(vertex) && !vbLeftReached[vertex] && vbRightReached[vertex]) RemoveVertex(vertex);
+    }
+
+    m_uNumLP += uSizeBefore - m_InGraph.Size();
+    return m_InGraph.Size() < uSizeBefore;
+}
+
+void IndependentSetReductions::GetKernel(vector<vector<int>> &vKernelAdjacencyArray, vector<int> &vKernelVertices) const
+{
+    vKernelVertices.assign(m_InGraph.begin(), m_InGraph.end());
+    sort(vKernelVertices.begin(), vKernelVertices.end());
+
+    vector<int> vLocalIndex(m_uNumVertices, -1);
+    for (size_t index = 0; index < vKernelVertices.size(); ++index) {
+        vLocalIndex[vKernelVertices[index]] = index;
+    }
+
+    vKernelAdjacencyArray.assign(vKernelVertices.size(), vector<int>());
+    for (size_t index = 0; index < vKernelVertices.size(); ++index) {
+        vector<int> &neighbors(vKernelAdjacencyArray[index]);
+        for (int const neighbor : m_vNeighbors[vKernelVertices[index]]) {
+            if (m_InGraph.Contains(neighbor)) neighbors.push_back(vLocalIndex[neighbor]);
+        }
+        sort(neighbors.begin(), neighbors.end());
+    }
+}
+
+size_t IndependentSetReductions::GetNumTaken() const
+{
+    size_t uNumTaken(m_vTaken.size());
+    for (Folding const &folding : m_vFoldings) {
+        uNumTaken += folding.vAlternatives.size();
+    }
+    return uNumTaken;
+}
+
+// foldings are undone last to first, as a later one may fold the
+// representative of an earlier one again.
+void IndependentSetReductions::LiftSolution(list<int> &independentSet) const
+{
+    vector<char> vbInSet(m_uNumVertices, 0);
+    for (int const vertex : independentSet) vbInSet[vertex] = 1;
+    for (int const vertex : m_vTaken)       vbInSet[vertex] = 1;
+
+    for (vector<Folding>::const_reverse_iterator it = m_vFoldings.rbegin(); it != m_vFoldings.rend(); ++it) {
+        for (int const vertex : (vbInSet[it->representative] ? it->vOthers : it->vAlternatives)) {
+            vbInSet[vertex] = 1;
+        }
+    }
+
+    independentSet.clear();
+    for (size_t vertex = 0; vertex < m_uNumVertices; ++vertex) {
+        if (vbInSet[vertex]) independentSet.push_back(vertex);
+    }
+}
+
+void IndependentSetReductions::PrintStatistics() const
+{
+    cerr << "Kernel Vertices    : " << m_InGraph.Size() << " of " << m_uNumVertices << endl;
+    cerr << "Degree 0/1 Taken   : " << m_uNumLowDegree << endl;
+    cerr << "Degree 2 Reductions: " << m_uNumDegreeTwo << endl;
+    cerr << "Dominated Vertices : " << m_uNumDominated << endl;
+    cerr << "Twin Reductions    : " << m_uNumTwins << endl;
+    cerr << "LP Reduced Vertices: " << m_uNumLP << endl;
+}
@@ -0,0 +1,102 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef INDEPENDENT_SET_REDUCTIONS_H
+#define INDEPENDENT_SET_REDUCTIONS_H
+
+#include "ArraySet.h"
+
+#include <vector>
+#include <list>
+
+// Exact reductions for maximum independent set, applied until none of them
+// changes the graph:
+//   - a vertex of degree 0 or 1 is taken, and its neighbor removed;
+//   - a vertex of degree 2 is taken if its neighbors are adjacent, and
+//     otherwise folded: it is removed, and its neighbors merged into one;
+//   - a vertex whose closed neighborhood contains that of a neighbor is
+//     removed (domination);
+//   - two non-adjacent vertices of degree 3 with the same neighbors are both
+//     taken if there is an edge between the neighbors, and otherwise removed,
+//     with their neighbors merged into one (twins);
+//   - the vertices that are 0 (1) in a half-integral optimum of the vertex
+//     cover LP, computed from a maximum matching of the bipartite double
+//     cover, are taken (removed), by Nemhauser and Trotter.
+//
+// The vertices of the residual graph are an ArraySet, so that removing one is
+// O(1); neighbor lists are not updated when a vertex is removed, only its
+// neighbors' degrees, and removed vertices are dropped from a list when it is
+// next needed whole. What is left is the kernel: a maximum independent set of
+// it, lifted with LiftSolution, is one of the graph, with GetNumTaken() more
+// vertices.
+class IndependentSetReductions
+{
+public:
+    IndependentSetReductions(std::vector<std::vector<int>> const &adjacencyArray);
+    ~IndependentSetReductions();
+
+    void Reduce();
+
+    // the kernel, renumbered 0..k-1 in increasing vertex order, with sorted
+    // neighbors; kernel vertex i is vKernelVertices[i] in the graph.
+    void GetKernel(std::vector<std::vector<int>> &vKernelAdjacencyArray, std::vector<int> &vKernelVertices) const;
+
+    size_t GetNumTaken() const;
+
+    // independentSet is an independent set of the kernel, in vertices of the
+    // graph, and becomes one of the graph.
+    void LiftSolution(std::list<int> &independentSet) const;
+
+    void PrintStatistics() const;
+
+protected:
+    bool ReduceLowDegree(int const vertex);
+    bool ReduceDegreeTwo(int const vertex);
+    bool ReduceTwin(int const vertex);
+    bool ReduceDominated(int const vertex);
+    bool ReduceLP();
+
+    std::vector<int> const &Neighbors(int const vertex);
+
+    void TakeVertex(int const vertex);
+    void RemoveVertex(int const vertex);
+    void Fold(int const representative, std::vector<int> const &vOthers, std::vector<int> const &vAlternatives);
+
+    // the representative stands for itself and the others, which are taken
+    // with it if it is in the independent set, and the alternatives if not.
+    struct Folding
+    {
+        int representative;
+        std::vector<int> vOthers;
+        std::vector<int> vAlternatives;
+    };
+
+    size_t m_uNumVertices;
+    ArraySet m_InGraph;
+    ArraySet m_Remaining; // vertices to test again
+    std::vector<std::vector<int>> m_vNeighbors; // may hold removed vertices, see Neighbors
+    std::vector<int> m_vDegree;
+    std::vector<char> m_vbMarked;
+    std::vector<int> m_vTaken;
+    std::vector<Folding> m_vFoldings;
+
+    size_t m_uNumLowDegree;
+    size_t m_uNumDegreeTwo;
+    size_t m_uNumDominated;
+    size_t m_uNumTwins;
+    size_t m_uNumLP;
+};
+
+#endif //INDEPENDENT_SET_REDUCTIONS_H
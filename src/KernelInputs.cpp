@@ -0,0 +1,173 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "KernelInputs.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+KernelInputs::KernelInputs(size_t const uSampleInterval, size_t const uMaximumVertices)
+: m_uSampleInterval(uSampleInterval)
+, m_uMaximumVertices(uMaximumVertices)
+, m_uSinceLastSample(0)
+, m_uNumVertices(0)
+, m_vInitialOrder()
+, m_vSamples()
+{
+}
+
+void KernelInputs::Add(vector<int> const &vParentOrder, int const chosenVertex, vector<int> const &vVertexOrder, int const bestCliqueSize, int const cliqueSize)
+{
+    m_vSamples.push_back(Sample());
+    Sample &sample(m_vSamples.back());
+    sample.bestCliqueSize = bestCliqueSize;
+    sample.cliqueSize     = cliqueSize;
+    sample.chosenVertex   = chosenVertex;
+    sample.vParentOrder   = vParentOrder;
+    sample.vVertexOrder   = vVertexOrder;
+    m_uNumVertices += vParentOrder.size() + vVertexOrder.size();
+}
+
+// The body is a list of int32_t's: the degree and neighbors of each vertex,
+// the initial order, and the samples.
+void KernelInputs::Write(string const &fileName, vector<vector<int>> const &adjacencyArray, bool const bIndependentSet) const
+{
+    vector<int32_t> vBody;
+    for (vector<int> const &neighbors : adjacencyArray) {
+        vBody.push_back(neighbors.size());
+        vBody.insert(vBody.end(), neighbors.begin(), neighbors.end());
+    }
+
+    vBody.push_back(m_vInitialOrder.size());
+    vBody.insert(vBody.end(), m_vInitialOrder.begin(), m_vInitialOrder.end());
+
+    vBody.push_back(m_vSamples.size());
+    for (Sample const &sample : m_vSamples) {
+        vBody.push_back(sample.bestCliqueSize);
+        vBody.push_back(sample.cliqueSize);
+        vBody.push_back(sample.chosenVertex);
+        vBody.push_back(sample.vParentOrder.size());
+        vBody.insert(vBody.end(), sample.vParentOrder.begin(), sample.vParentOrder.end());
+        vBody.push_back(sample.vVertexOrder.size());
+        vBody.insert(vBody.end(), sample.vVertexOrder.begin(), sample.vVertexOrder.end());
+    }
+
+    Header header;
+    memset(&header, 0, sizeof(Header));
+    memcpy(header.magic, Magic(), sizeof(header.magic));
+    header.numVertices    = adjacencyArray.size();
+    header.independentSet = bIndependentSet ? 1 : 0;
+    header.bodySize       = vBody.size();
+
+    FILE *pFile(fopen(fileName.c_str(), "wb"));
+    if (pFile == nullptr) {
+        fprintf(stderr, "ERROR: Unable to open file %s for writing\n", fileName.c_str());
+        exit(1);
+    }
+
+    bool bWritten(fwrite(&header, sizeof(Header), 1, pFile) == 1);
+    bWritten = bWritten && fwrite(vBody.data(), sizeof(int32_t), vBody.size(), pFile) == vBody.size();
+    if (fclose(pFile) != 0 || !bWritten) {
+        fprintf(stderr, "ERROR: Problem writing kernel inputs %s\n", fileName.c_str());
+        exit(1);
+    }
+}
+
+void KernelInputs::Read(string const &fileName, vector<vector<int>> &adjacencyArray, bool &bIndependentSet)
+{
+    FILE *pFile(fopen(fileName.c_str(), "rb"));
+    if (pFile == nullptr) {
+        fprintf(stderr, "ERROR: Unable to open file %s\n", fileName.c_str());
+        exit(1);
+    }
+
+    Header header;
+    if (fread(&header, sizeof(Header), 1, pFile) != 1 || memcmp(header.magic, Magic(), sizeof(header.magic)) != 0) {
+        fprintf(stderr, "ERROR: File %s does not hold kernel inputs\n", fileName.c_str());
+        exit(1);
+    }
+
+    vector<int32_t> vBody(header.bodySize);
+    bool const bRead(fread(vBody.data(), sizeof(int32_t), vBody.size(), pFile) == vBody.size());
+    fclose(pFile);
+
+    size_t uNext(0);
+    bool bTruncated(!bRead);
+    auto nextValue = [&]() -> int {
+        if (uNext >= vBody.size()) {
+            bTruncated = true;
+            return 0;
+        }
+        return vBody[uNext++];
+    };
+    auto nextList = [&](vector<int> &vList) {
+        int const size(nextValue());
+        if (size < 0 || static_cast<size_t>(size) > vBody.size() - uNext) {
+            bTruncated = true;
+            return;
+        }
+        vList.assign(vBody.begin() + uNext, vBody.begin() + uNext + size);
+        uNext += size;
+    };
+
+    bIndependentSet = (header.independentSet != 0);
+    adjacencyArray.assign(header.numVertices, vector<int>());
+    for (size_t vertex = 0; vertex < adjacencyArray.size() && !bTruncated; ++vertex) {
+        nextList(adjacencyArray[vertex]);
+    }
+
+    nextList(m_vInitialOrder);
+
+    m_vSamples.clear();
+    int const numSamples(nextValue());
+    for (int index = 0; index < numSamples && !bTruncated; ++index) {
+        m_vSamples.push_back(Sample());
+        Sample &sample(m_vSamples.back());
+        sample.bestCliqueSize = nextValue();
+        sample.cliqueSize     = nextValue();
+        sample.chosenVertex   = nextValue();
+        nextList(sample.vParentOrder);
+        nextList(sample.vVertexOrder);
+    }
+
+    if (bTruncated) {
+        fprintf(stderr, "ERROR: Kernel inputs %s are truncated\n", fileName.c_str());
+        exit(1);
+    }
+
+    auto isVertexList = [&](vector<int> const &vList) {
+        for (int const vertex : vList) {
+            if (vertex < 0 || static_cast<size_t>(vertex) >= adjacencyArray.size()) return false;
+        }
+        return true;
+    };
+
+    bool bValid(isVertexList(m_vInitialOrder));
+    for (vector<int> const &neighbors : adjacencyArray) {
+        bValid = bValid && isVertexList(neighbors);
+    }
+    for (Sample const &sample : m_vSamples) {
+        bValid = bValid && isVertexList(sample.vParentOrder) && isVertexList(sample.vVertexOrder);
+        bValid = bValid && sample.chosenVertex >= 0 && static_cast<size_t>(sample.chosenVertex) < adjacencyArray.size();
+    }
+
+    if (!bValid) {
+        fprintf(stderr, "ERROR: Kernel inputs %s name vertices outside of the graph\n", fileName.c_str());
+        exit(1);
+    }
+}
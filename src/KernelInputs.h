@@ -0,0 +1,82 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef KERNEL_INPUTS_H
+#define KERNEL_INPUTS_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+// Inputs to the coloring and candidate filtering kernels, sampled from a real
+// search so that open-mcs-kernel-bench can replay them in isolation: the
+// graph, the initial vertex order, and for every interval-th child that is
+// colored, the order its candidates were filtered from, the vertex chosen,
+// and the order it was colored in.
+class KernelInputs
+{
+public:
+    struct Sample
+    {
+        int bestCliqueSize; // the sizes Recolor is called with
+        int cliqueSize;
+        int chosenVertex;
+        std::vector<int> vParentOrder;
+        std::vector<int> vVertexOrder;
+    };
+
+    // sampling stops once the samples hold uMaximumVertices vertices.
+    KernelInputs(size_t const uSampleInterval, size_t const uMaximumVertices);
+
+    // true if the next child colored should be sampled.
+    bool Due()
+    {
+        if (m_uNumVertices >= m_uMaximumVertices || ++m_uSinceLastSample < m_uSampleInterval) return false;
+        m_uSinceLastSample = 0;
+        return true;
+    }
+
+    void Add(std::vector<int> const &vParentOrder, int const chosenVertex, std::vector<int> const &vVertexOrder, int const bestCliqueSize, int const cliqueSize);
+    void SetInitialOrder(std::vector<int> const &vInitialOrder) { m_vInitialOrder = vInitialOrder; }
+
+    std::vector<int>    const &GetInitialOrder() const { return m_vInitialOrder; }
+    std::vector<Sample> const &GetSamples() const      { return m_vSamples; }
+
+    // adjacencyArray is the graph the search ran on, bIndependentSet if it
+    // searched for independent sets.
+    void Write(std::string const &fileName, std::vector<std::vector<int>> const &adjacencyArray, bool const bIndependentSet) const;
+    void Read(std::string const &fileName, std::vector<std::vector<int>> &adjacencyArray, bool &bIndependentSet);
+
+    static char const *Magic() { return "OMCSKIN1"; }
+
+    struct Header
+    {
+        char     magic[8];
+        uint64_t numVertices;
+        uint64_t independentSet;
+        uint64_t bodySize; // number of int32_t's after the header
+    };
+
+private:
+    size_t m_uSampleInterval;
+    size_t m_uMaximumVertices;
+    size_t m_uSinceLastSample;
+    size_t m_uNumVertices; // in the orders of the samples
+    std::vector<int>    m_vInitialOrder;
+    std::vector<Sample> m_vSamples;
+};
+
+#endif //KERNEL_INPUTS_H
@@ -15,6 +15,7 @@
 
 #include "MCQ.h"
 #include "OrderingTools.h"
+#include "CandidateFilters.h"
 
 #include <cmath>
 #include <iostream>
@@ -25,20 +26,30 @@ MCQ::MCQ(vector<vector<char>> const &vAdjacencyMatrix)
 : MaxSubgraphAlgorithm("mcq")
 , m_AdjacencyMatrix(vAdjacencyMatrix)
 , coloringStrategy(m_AdjacencyMatrix)
+, m_pBitSetColoringStrategy(nullptr)
+, m_pColoringStrategy(&coloringStrategy)
+, m_bIncrementalColoring(false)
 ////, m_bInvert(0)
 {
     R.reserve(m_AdjacencyMatrix.size());
 
-    stackP.resize(m_AdjacencyMatrix.size() + 1);
-    stackColors.resize(m_AdjacencyMatrix.size() + 1);
-    stackOrder.resize(m_AdjacencyMatrix.size() + 1);
-    stackEvaluatedHalfVertices.resize(m_AdjacencyMatrix.size() + 1);
+    // the search frames are allocated in Run, once the initial coloring
+    // bounds how many are needed.
+}
+
+MCQ::~MCQ()
+{
+    delete m_pBitSetColoringStrategy; m_pBitSetColoringStrategy = nullptr;
+}
 
-    // don't reserve for 0-th vectors, they get std::move'd by InitialOrdering
-    for (int index = 0; index < stackP.size(); ++index) {
-        stackP[index].reserve(m_AdjacencyMatrix.size());
-        stackColors[index].reserve(m_AdjacencyMatrix.size());
-        stackOrder[index].reserve(m_AdjacencyMatrix.size());
+void MCQ::SetBitSetColoring(bool const bitSetColoring)
+{
+    delete m_pBitSetColoringStrategy; m_pBitSetColoringStrategy = nullptr;
+    m_pColoringStrategy = &coloringStrategy;
+
+    if (bitSetColoring) {
+        m_pBitSetColoringStrategy = new BitSetCliqueColoringStrategy(m_AdjacencyMatrix);
+        m_pColoringStrategy = m_pBitSetColoringStrategy;
     }
 }
 
@@ -53,9 +64,21 @@ void MCQ::InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, s
     vVertexOrder = P;
 }
 
+void MCQ::AdoptInitialOrder(std::vector<int> const &vVertexOrder)
+{
+    if (m_pBitSetColoringStrategy != nullptr) m_pBitSetColoringStrategy->SetVertexOrder(vVertexOrder);
+}
+
 void MCQ::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
 {
-    coloringStrategy.Color(m_AdjacencyMatrix, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors);
+    // the parent's frame is the one below the child's, and R ends with the chosen vertex.
+    if (m_bIncrementalColoring) {
+        SearchFrame const &parentFrame(m_vSearchFrames[R.size()-1]);
+        coloringStrategy.IncrementalRecolor(m_AdjacencyMatrix, vVertexOrder, parentFrame.P, parentFrame.vColors, R.back(), vVerticesToReorder, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()), false /* no Repair */);
+        return;
+    }
+
+    m_pColoringStrategy->Color(m_AdjacencyMatrix, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors);
 ////    cout << "Colors:";
 ////    for (int const color : vColors) {
 ////        cout << color << " ";
@@ -71,15 +94,7 @@ void MCQ::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVertexOrder, v
 ////    }
 ////    cout << endl;
 
-    vNewVertexOrder.resize(P.size());
-    {
-        size_t uNewIndex(0);
-        for (int const candidate : P) {
-////            if (!m_bInvert && m_AdjacencyMatrix[chosenVertex][candidate]) vNewVertexOrder[uNewIndex++] = candidate;
-            if (m_AdjacencyMatrix[chosenVertex][candidate]) vNewVertexOrder[uNewIndex++] = candidate;
-        }
-        vNewVertexOrder.resize(uNewIndex);
-    }
+    CandidateFilters::Neighbors(m_AdjacencyMatrix, P, chosenVertex, vNewVertexOrder);
 
 ////    cout << "NewOrder:";
 ////    for (int const vertex : vNewVertexOrder) {
@@ -94,3 +109,8 @@ void MCQ::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector
 {
     if (chosenVertex != -1) R.pop_back();
 }
+
+void MCQ::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<MCQ>(P, vVertexOrder, cliques, vColors);
+}
@@ -18,6 +18,7 @@
 
 #include "MaxSubgraphAlgorithm.h"
 #include "CliqueColoringStrategy.h"
+#include "BitSetCliqueColoringStrategy.h"
 
 #include <vector>
 #include <list>
@@ -26,20 +27,33 @@ class MCQ : public MaxSubgraphAlgorithm
 {
 public:
     MCQ(std::vector<std::vector<char>> const &vAdjacencyMatrix);
-////    virtual ~MCQ();
+    virtual ~MCQ();
 
     virtual void Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors);
 
     virtual void InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors);
+    virtual void AdoptInitialOrder(std::vector<int> const &vVertexOrder);
     virtual void GetNewOrder(std::vector<int> &vNewVertexOrder, std::vector<int> &vVertexOrder, std::vector<int> const &P, int const chosenVertex);
     virtual void ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex);
     virtual void ProcessOrderBeforeReturn(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors) {}
 
+    virtual void RunRecursive(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
+
+    virtual ColoringStrategy const *GetColoringStrategy() const { return m_pColoringStrategy; }
+
 ////    void SetInvert(bool const invert);
 
+    void SetBitSetColoring(bool const bitSetColoring);
+
+    // color each child from the classes of its parent, see CliqueColoringStrategy::IncrementalRecolor.
+    void SetIncrementalColoring(bool const incrementalColoring) { m_bIncrementalColoring = incrementalColoring; }
+
 protected:
     std::vector<std::vector<char>> const &m_AdjacencyMatrix;
     CliqueColoringStrategy coloringStrategy;
+    BitSetCliqueColoringStrategy *m_pBitSetColoringStrategy;
+    ColoringStrategy *m_pColoringStrategy; // coloringStrategy, unless bitset coloring is enabled
+    bool m_bIncrementalColoring;
 ////    bool m_bInvert;
 };
 #endif
@@ -30,5 +30,16 @@ MCS::MCS(vector<vector<char>> const &vAdjacencyMatrix)
 
 void MCS::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
 {
-    coloringStrategy.Recolor(m_AdjacencyMatrix, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()));
+    if (m_bIncrementalColoring) {
+        SearchFrame const &parentFrame(m_vSearchFrames[R.size()-1]);
+        coloringStrategy.IncrementalRecolor(m_AdjacencyMatrix, vVertexOrder, parentFrame.P, parentFrame.vColors, R.back(), vVerticesToReorder, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()), true /* Repair */);
+        return;
+    }
+
+    m_pColoringStrategy->Recolor(m_AdjacencyMatrix, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()));
+}
+
+void MCS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<MCS>(P, vVertexOrder, cliques, vColors);
 }
@@ -28,6 +28,8 @@ public:
     MCS(std::vector<std::vector<char>> const &vAdjacencyMatrix);
 
     virtual void Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors);
+
+    virtual void RunRecursive(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
 };
 
 #endif //LIGHTWEIGHT_FULL_MCS_H
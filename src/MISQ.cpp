@@ -15,6 +15,7 @@
 
 #include "MISQ.h"
 #include "OrderingTools.h"
+#include "CandidateFilters.h"
 #include "Tools.h"
 
 #include <cmath>
@@ -29,17 +30,8 @@ MISQ::MISQ(vector<vector<char>> const &vAdjacencyMatrix)
 {
     R.reserve(m_AdjacencyMatrix.size());
 
-    stackP.resize(m_AdjacencyMatrix.size() + 1);
-    stackColors.resize(m_AdjacencyMatrix.size() + 1);
-    stackOrder.resize(m_AdjacencyMatrix.size() + 1);
-    stackEvaluatedHalfVertices.resize(m_AdjacencyMatrix.size() + 1);
-
-    // don't reserve for 0-th vectors, they get std::move'd by InitialOrdering
-    for (int index = 0; index < stackP.size(); ++index) {
-        stackP[index].reserve(m_AdjacencyMatrix.size());
-        stackColors[index].reserve(m_AdjacencyMatrix.size());
-        stackOrder[index].reserve(m_AdjacencyMatrix.size());
-    }
+    // the search frames are allocated in Run, once the initial coloring
+    // bounds how many are needed.
 }
 
 void MISQ::InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors)
@@ -55,15 +47,7 @@ void MISQ::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVertic
 
 void MISQ::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVertexOrder, vector<int> const &P, int const chosenVertex)
 {
-    vNewVertexOrder.resize(P.size());
-    {
-        size_t uNewIndex(0);
-        for (int const candidate : P) {
-            if (chosenVertex == candidate) continue;
-            if (!m_AdjacencyMatrix[chosenVertex][candidate]) vNewVertexOrder[uNewIndex++] = candidate;
-        }
-        vNewVertexOrder.resize(uNewIndex);
-    }
+    CandidateFilters::NonNeighbors(m_AdjacencyMatrix, P, chosenVertex, vNewVertexOrder);
 
     R.push_back(chosenVertex);
 }
@@ -75,3 +59,7 @@ void MISQ::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vecto
     if (chosenVertex != -1) R.pop_back();
 }
 
+void MISQ::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<MISQ>(P, vVertexOrder, cliques, vColors);
+}
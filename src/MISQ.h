@@ -38,6 +38,10 @@ public:
     virtual void ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex);
     virtual void ProcessOrderBeforeReturn(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors) {}
 
+    virtual void RunRecursive(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
+
+    virtual ColoringStrategy const *GetColoringStrategy() const { return &coloringStrategy; }
+
 ////    void SetInvert(bool const invert);
 
 protected:
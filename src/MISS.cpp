@@ -32,3 +32,8 @@ void MISS::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVertic
 {
     coloringStrategy.Recolor(m_AdjacencyMatrix, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()));
 }
+
+void MISS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<MISS>(P, vVertexOrder, cliques, vColors);
+}
@@ -0,0 +1,194 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "MaxSatBound.h"
+
+using namespace std;
+
+MaxSatBound::MaxSatBound(vector<vector<char>> const &adjacencyMatrix, bool const bIndependentSet)
+: m_AdjacencyMatrix(adjacencyMatrix)
+, m_bIndependentSet(bIndependentSet)
+, m_vClassBegin()
+, m_vbClassActive()
+, m_vNumAlive()
+, m_vReason()
+, m_vbRemoved()
+, m_vUnitClasses()
+, m_vbQueued()
+, m_vbInConflict()
+, m_vConflictClasses()
+, m_vStack()
+, m_uNumTests(0)
+, m_uNumPrunes(0)
+{
+}
+
+bool MaxSatBound::Prunes(vector<int> const &vVertices, vector<int> const &vColors, int const iLimit)
+{
+    m_uNumTests++;
+
+    // the classes are the runs of equal colors.
+    size_t const numVertices(vVertices.size());
+    m_vClassBegin.clear();
+    for (size_t index = 0; index < numVertices; ++index) {
+        if (index == 0 || vColors[index] != vColors[index-1]) m_vClassBegin.push_back(index);
+    }
+    int const numClasses(static_cast<int>(m_vClassBegin.size()));
+    m_vClassBegin.push_back(numVertices);
+
+    m_vbClassActive.assign(numClasses, 1);
+    m_vNumAlive.resize(numClasses);
+    m_vbQueued.resize(numClasses);
+    m_vbInConflict.assign(numClasses, 0);
+    m_vConflictClasses.clear();
+    m_vReason.resize(numVertices);
+    m_vbRemoved.resize(numVertices);
+
+    // each inconsistent set of classes loses at least one of them.
+    for (int found = 0; found < numClasses - iLimit; ++found) {
+        if (!FindInconsistentClasses(vVertices)) return false;
+        for (int const conflictClass : m_vConflictClasses) {
+            m_vbClassActive[conflictClass] = 0;
+        }
+    }
+
+    m_uNumPrunes++;
+    return true;
+}
+
+void MaxSatBound::ResetPropagation(vector<int> const &vVertices)
+{
+    int const numClasses(static_cast<int>(m_vClassBegin.size()) - 1);
+    m_vUnitClasses.clear();
+    for (int currentClass = 0; currentClass < numClasses; ++currentClass) {
+        m_vNumAlive[currentClass] = static_cast<int>(m_vClassBegin[currentClass+1] - m_vClassBegin[currentClass]);
+        m_vbQueued[currentClass] = 0;
+        if (m_vbClassActive[currentClass] && m_vNumAlive[currentClass] == 1) {
+            m_vbQueued[currentClass] = 1;
+            m_vUnitClasses.push_back(currentClass);
+        }
+    }
+
+    for (size_t index = 0; index < vVertices.size(); ++index) {
+        m_vbRemoved[index] = 0;
+        m_vReason[index]   = -1;
+    }
+}
+
+// returns a class that propagation emptied, or -1 if there is none.
+int MaxSatBound::Propagate(vector<int> const &vVertices)
+{
+    int const numClasses(static_cast<int>(m_vClassBegin.size()) - 1);
+    for (size_t next = 0; next < m_vUnitClasses.size(); ++next) {
+        int const unitClass(m_vUnitClasses[next]);
+
+        size_t unitIndex(m_vClassBegin[unitClass]);
+        while (m_vbRemoved[unitIndex]) unitIndex++;
+        int const unitVertex(vVertices[unitIndex]);
+
+        for (int otherClass = 0; otherClass < numClasses; ++otherClass) {
+            if (otherClass == unitClass || !m_vbClassActive[otherClass]) continue;
+
+            for (size_t index = m_vClassBegin[otherClass]; index < m_vClassBegin[otherClass+1]; ++index) {
+                if (m_vbRemoved[index] || Compatible(unitVertex, vVertices[index])) continue;
+                m_vbRemoved[index] = 1;
+                m_vReason[index]   = unitClass;
+                m_vNumAlive[otherClass]--;
+            }
+
+            if (m_vNumAlive[otherClass] == 0) return otherClass;
+            if (m_vNumAlive[otherClass] == 1 && !m_vbQueued[otherClass]) {
+                m_vbQueued[otherClass] = 1;
+                m_vUnitClasses.push_back(otherClass);
+            }
+        }
+    }
+
+    return -1;
+}
+
+// adds the emptied class, and the unit classes that emptied it, recursively.
+void MaxSatBound::AddConflictingClasses(int const conflictClass)
+{
+    if (!m_vbInConflict[conflictClass]) {
+        m_vbInConflict[conflictClass] = 1;
+        m_vConflictClasses.push_back(conflictClass);
+    }
+
+    m_vStack.clear();
+    m_vStack.push_back(conflictClass);
+    while (!m_vStack.empty()) {
+        int const currentClass(m_vStack.back()); m_vStack.pop_back();
+        for (size_t index = m_vClassBegin[currentClass]; index < m_vClassBegin[currentClass+1]; ++index) {
+            int const reason(m_vReason[index]);
+            if (!m_vbRemoved[index] || reason < 0 || m_vbInConflict[reason]) continue;
+            m_vbInConflict[reason] = 1;
+            m_vConflictClasses.push_back(reason);
+            m_vStack.push_back(reason);
+        }
+    }
+}
+
+// finds a set of active classes that no clique has a vertex in all of.
+bool MaxSatBound::FindInconsistentClasses(vector<int> const &vVertices)
+{
+    for (int const conflictClass : m_vConflictClasses) {
+        m_vbInConflict[conflictClass] = 0;
+    }
+    m_vConflictClasses.clear();
+
+    ResetPropagation(vVertices);
+    int const conflictClass(Propagate(vVertices));
+    if (conflictClass >= 0) {
+        AddConflictingClasses(conflictClass);
+        return true;
+    }
+
+    // failed literals: if every vertex of a class leads to a conflict, the
+    // class and all of the conflicting classes are inconsistent.
+    int const numClasses(static_cast<int>(m_vClassBegin.size()) - 1);
+    int testClass(-1);
+    size_t uTestClassSize(0);
+    for (int currentClass = 0; currentClass < numClasses; ++currentClass) {
+        size_t const uSize(m_vClassBegin[currentClass+1] - m_vClassBegin[currentClass]);
+        if (!m_vbClassActive[currentClass] || uSize < 2) continue;
+        if (testClass == -1 || uSize < uTestClassSize) {
+            testClass = currentClass;
+            uTestClassSize = uSize;
+        }
+    }
+
+    if (testClass == -1) return false;
+
+    for (size_t decision = m_vClassBegin[testClass]; decision < m_vClassBegin[testClass+1]; ++decision) {
+        ResetPropagation(vVertices);
+        for (size_t index = m_vClassBegin[testClass]; index < m_vClassBegin[testClass+1]; ++index) {
+            if (index != decision) m_vbRemoved[index] = 1;
+        }
+        m_vNumAlive[testClass] = 1;
+        m_vbQueued[testClass] = 1;
+        m_vUnitClasses.push_back(testClass);
+
+        int const decisionConflict(Propagate(vVertices));
+        if (decisionConflict < 0) return false;
+        AddConflictingClasses(decisionConflict);
+    }
+
+    if (!m_vbInConflict[testClass]) {
+        m_vbInConflict[testClass] = 1;
+        m_vConflictClasses.push_back(testClass);
+    }
+    return true;
+}
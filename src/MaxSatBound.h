@@ -0,0 +1,76 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef MAX_SAT_BOUND_H
+#define MAX_SAT_BOUND_H
+
+#include <vector>
+#include <cstddef>
+
+// A second bound on the largest clique (or independent set) among colored
+// candidates, for when the number of colors doesn't prune. Each color class
+// is a soft clause, as a clique has at most one vertex in each, and unit
+// propagation finds sets of classes that no clique can have a vertex in all
+// of: taking the only vertex left in a class removes its non-neighbors from
+// the other classes, until one of them is empty. If no class has one vertex,
+// each vertex of the smallest class is tried in turn (failed literal
+// detection). Every disjoint such set lowers the bound by one, as in the
+// MaxSAT reasoning of Li and Quan (2010).
+//
+// Uses the same adjacency matrix as the algorithm's coloring strategy, with
+// bIndependentSet for the independent set algorithms, whose matrices have
+// diagonals and whose classes are cliques.
+class MaxSatBound
+{
+public:
+    MaxSatBound(std::vector<std::vector<char>> const &adjacencyMatrix, bool const bIndependentSet);
+
+    // true if no clique in vVertices has more than iLimit vertices, where
+    // vColors is a coloring of vVertices, in increasing order.
+    bool Prunes(std::vector<int> const &vVertices, std::vector<int> const &vColors, int const iLimit);
+
+    size_t GetNumTests() const  { return m_uNumTests; }
+    size_t GetNumPrunes() const { return m_uNumPrunes; }
+
+protected:
+    bool Compatible(int const vertex, int const other) const
+    {
+        return m_bIndependentSet ? !m_AdjacencyMatrix[vertex][other] : m_AdjacencyMatrix[vertex][other];
+    }
+
+    void ResetPropagation(std::vector<int> const &vVertices);
+    int  Propagate(std::vector<int> const &vVertices);
+    void AddConflictingClasses(int const conflictClass);
+    bool FindInconsistentClasses(std::vector<int> const &vVertices);
+
+    std::vector<std::vector<char>> const &m_AdjacencyMatrix;
+    bool m_bIndependentSet;
+
+    std::vector<size_t> m_vClassBegin;    // class -> index of its first vertex, and one past the last class
+    std::vector<char>   m_vbClassActive;  // not yet in an inconsistent set
+    std::vector<int>    m_vNumAlive;      // class -> vertices not removed by propagation
+    std::vector<int>    m_vReason;        // index -> class whose unit vertex removed it, -1 if alive or decided
+    std::vector<char>   m_vbRemoved;      // index -> removed by propagation
+    std::vector<int>    m_vUnitClasses;   // classes to propagate
+    std::vector<char>   m_vbQueued;
+    std::vector<char>   m_vbInConflict;   // class -> in the inconsistent set being built
+    std::vector<int>    m_vConflictClasses;
+    std::vector<int>    m_vStack;
+
+    size_t m_uNumTests;
+    size_t m_uNumPrunes;
+};
+
+#endif //MAX_SAT_BOUND_H
@@ -17,29 +17,155 @@
 #include "Tools.h"
 
 #include <iostream>
+#include <algorithm>
+#include <thread>
+#include <cstdint>
 
 using namespace std;
 
 MaxSubgraphAlgorithm::MaxSubgraphAlgorithm(string const &name)
 : Algorithm(name)
 , m_uMaximumCliqueSize(0)
-, stackP()
-, stackColors()
-, stackOrder()
+, m_vSearchFrames(1)
 , nodeCount(0)
 , depth(-1)
 , startTime(clock())
 , timeToLargestClique(0)
 , m_bQuiet(true)
-, stackEvaluatedHalfVertices()
+, stackEvaluatedHalfVertices(2)
 ////, m_bInvert(0)
 , m_iOnlyVertex(-1)
-, m_TimeOut(0)
-, m_StartTime(clock())
-, m_bTimedOut(false)
+, m_pLimits(nullptr)
+, m_uNodesSinceLimitCheck(0)
+, m_uNodesPerLimitCheck(0)
+, m_bSearchStopped(false)
+, m_uSearchBound(0)
+, m_pStatistics(nullptr)
+, m_pKernelInputs(nullptr)
+, m_pMaxSatBound(nullptr)
+, m_pCheckpoint(nullptr)
+, m_vCheckpointState()
+, m_sResumeFileName()
+, m_bResuming(false)
+, m_uResumeEntryLevel(0)
+, m_uResumeLevel(0)
+, m_pParallelState(nullptr)
+, m_iWorkerIndex(0)
+, m_pInitialOrder(nullptr)
+, m_uRootBranch(0)
+, m_uStealCount(0)
+, m_uDonationCount(0)
+, m_vbInTask()
 {
 }
 
+void MaxSubgraphAlgorithm::RecordClique(list<list<int>> &cliques)
+{
+    cliques.back().clear();
+    cliques.back().insert(cliques.back().end(), R.begin(), R.end());
+    ExecuteCallBacks(cliques.back());
+    m_uMaximumCliqueSize = R.size();
+    timeToLargestClique = clock() - startTime;
+    RecordTimeOfLargestClique();
+    PublishMaximumCliqueSize();
+}
+
+void MaxSubgraphAlgorithm::PublishMaximumCliqueSize()
+{
+    if (m_pParallelState == nullptr) return;
+    size_t uSharedCliqueSize(m_pParallelState->m_uMaximumCliqueSize.load());
+    while (uSharedCliqueSize < m_uMaximumCliqueSize &&
+           !m_pParallelState->m_uMaximumCliqueSize.compare_exchange_weak(uSharedCliqueSize, m_uMaximumCliqueSize)) {
+    }
+}
+
+// Every worker walks the same root branches in the same order, so the first
+// worker to reach a branch claims it, and the others skip it.
+bool MaxSubgraphAlgorithm::ClaimRootBranch()
+{
+    if (m_pParallelState == nullptr) return true;
+    size_t uBranch(m_uRootBranch++);
+    return m_pParallelState->m_uNextRootBranch.compare_exchange_strong(uBranch, m_uRootBranch);
+}
+
+// Hand the first half of the branches left at this node to an idle worker.
+// Those branches are evaluated last, and the vertices before them in P are
+// their candidates, so the task is the prefix P[0..split), with the
+// evaluation order restricted to it. Returns where this worker should stop,
+// or 0 if there was not enough left to split.
+size_t MaxSubgraphAlgorithm::DonateBranches(vector<int> const &P, vector<int> const &vVertexOrder, vector<int> const &vColors)
+{
+    // vertices that will be pruned still belong to the task, as candidates.
+    size_t uFirstBranch(0);
+    while (uFirstBranch < P.size() && R.size() + vColors[uFirstBranch] <= m_uMaximumCliqueSize) {
+        uFirstBranch++;
+    }
+
+    if (P.size() - uFirstBranch < 2) return 0;
+
+    size_t const uSplitIndex(uFirstBranch + (P.size() - uFirstBranch)/2);
+
+    SearchTask task;
+    task.R = R;
+    task.depth = depth;
+    task.P.assign(P.begin(), P.begin() + uSplitIndex);
+    task.vColors.assign(vColors.begin(), vColors.begin() + uSplitIndex);
+
+    for (int const vertex : task.P) {
+        if (m_vbInTask.size() <= static_cast<size_t>(vertex)) m_vbInTask.resize(vertex + 1, false);
+        m_vbInTask[vertex] = true;
+    }
+
+    task.vVertexOrder.reserve(task.P.size());
+    for (int const vertex : vVertexOrder) {
+        if (static_cast<size_t>(vertex) < m_vbInTask.size() && m_vbInTask[vertex]) task.vVertexOrder.push_back(vertex);
+    }
+
+    for (int const vertex : task.P) {
+        m_vbInTask[vertex] = false;
+    }
+
+    m_pParallelState->PushTask(m_iWorkerIndex, task);
+    m_uDonationCount++;
+    return uSplitIndex;
+}
+
+// Once its root branches are done, a worker evaluates tasks from its own
+// deque, or steals them from other workers, until every worker is idle.
+void MaxSubgraphAlgorithm::RunStolenTasks(list<list<int>> &cliques)
+{
+    if (m_pParallelState == nullptr || !m_pParallelState->m_bWorkStealing) return;
+
+    if (cliques.empty()) cliques.push_back(list<int>());
+
+    m_pParallelState->m_iNumBusyWorkers--;
+
+    SearchTask task;
+    bool bStolen(false);
+    while (!m_bSearchStopped && (m_pLimits == nullptr || !m_pLimits->Stopped())) {
+        if (m_pParallelState->PopTask(m_iWorkerIndex, task, bStolen)) {
+            if (bStolen) m_uStealCount++;
+
+            R = task.R;
+            depth = task.depth;
+            m_uSearchBound = R.size() + task.vColors.back();
+            ReserveSearchFrames(R.size() + 2);
+            SearchFrame &frame(m_vSearchFrames[R.size()]);
+            frame.P.swap(task.P);
+            frame.vColors.swap(task.vColors);
+            frame.vVertexOrder.swap(task.vVertexOrder);
+
+            RunRecursive(frame.P, frame.vVertexOrder, cliques, frame.vColors);
+
+            m_pParallelState->m_iNumBusyWorkers--;
+            continue;
+        }
+
+        if (m_pParallelState->IsFinished()) break;
+        this_thread::yield();
+    }
+}
+
 ////void MaxSubgraphAlgorithm::SetInvert(bool const invert)
 ////{
 ////    m_bInvert = invert;
@@ -47,186 +173,194 @@ MaxSubgraphAlgorithm::MaxSubgraphAlgorithm(string const &name)
 
 long MaxSubgraphAlgorithm::Run(list<std::list<int>> &cliques)
 {
-    vector<int> &P(stackP[0]);
-    vector<int> &vColors(stackColors[0]);
-    vector<int> &vVertexOrder(stackOrder[0]);
-
-    bool bMaximumCliqueSizeIsSet(m_uMaximumCliqueSize != 0);
-
-    InitializeOrder(P, vVertexOrder, vColors);
+    // references into frame 0, so they are not used after the frames are reserved.
+    vector<int> &P(m_vSearchFrames[0].P);
+    vector<int> &vColors(m_vSearchFrames[0].vColors);
+    vector<int> &vVertexOrder(m_vSearchFrames[0].vVertexOrder);
+
+    size_t const uPresetCliqueSize(m_uMaximumCliqueSize);
+
+    m_pLimits = GetSearchLimits();
+    if (m_pLimits != nullptr) m_uNodesPerLimitCheck = m_pLimits->NodesUntilNextCheck();
+    m_pStatistics = GetSearchStatistics();
+
+    {
+        PerfPhase const phase(PerfProfile::Active(), PerfProfile::InitialOrdering);
+        if (m_pInitialOrder != nullptr) {
+            P            = m_pInitialOrder->P;
+            vVertexOrder = m_pInitialOrder->vVertexOrder;
+            vColors      = m_pInitialOrder->vColors;
+            m_uMaximumCliqueSize = max(m_uMaximumCliqueSize, m_pInitialOrder->uCliqueSize);
+        } else {
+            InitializeOrder(P, vVertexOrder, vColors);
+        }
+        AdoptInitialOrder(vVertexOrder);
+    }
+    if (m_pKernelInputs != nullptr) m_pKernelInputs->SetInitialOrder(vVertexOrder);
 
     cliques.push_back(list<int>());
 
-    if (!bMaximumCliqueSizeIsSet && R.size() < m_uMaximumCliqueSize) {
+    // the initial ordering may find a clique larger than any preset size.
+    if (R.size() < m_uMaximumCliqueSize && m_uMaximumCliqueSize > uPresetCliqueSize) {
         cliques.back().clear();
         cliques.back().insert(cliques.back().end(), P.begin(), P.begin() + m_uMaximumCliqueSize);
+        RecordTimeOfLargestClique();
         ExecuteCallBacks(cliques.back());
+        PublishMaximumCliqueSize();
     }
 
     ProcessOrderAfterRecursion(vVertexOrder, P, vColors, -1 /* no vertex chosen for removal */);
 
     if (R.size() > m_uMaximumCliqueSize) {
-        cliques.back().clear();
-        cliques.back().insert(cliques.back().end(), R.begin(), R.end());
-        ExecuteCallBacks(cliques.back());
-        m_uMaximumCliqueSize = R.size();
-        timeToLargestClique = clock() - startTime;
+        RecordClique(cliques);
     }
 
     depth++;
     if (!P.empty()) {
-        RunRecursive(P, vVertexOrder, cliques, vColors);
+        // a clique (or independent set) in P is no larger than the largest
+        // initial color, so that bounds the number of frames the search uses.
+        // A single vertex is left uncolored (-1), so the bound is kept in [1, |P|].
+        size_t uLargestColor(P.size());
+        if (!vColors.empty()) {
+            int const largestColor(*max_element(vColors.begin(), vColors.end()));
+            uLargestColor = min(P.size(), static_cast<size_t>(max(largestColor, 1)));
+        }
+        ReserveSearchFrames(R.size() + uLargestColor + 2);
+        m_uSearchBound = R.size() + uLargestColor;
+
+        if (!m_sResumeFileName.empty() && !ResumeFromCheckpoint(cliques)) {
+            cerr << "NOTE: No checkpoint " << m_sResumeFileName << " to resume from, starting a new search" << endl;
+        }
+
+        SearchFrame &frame(m_vSearchFrames[0]);
+        RunRecursive(frame.P, frame.vVertexOrder, cliques, frame.vColors);
+    }
+
+    // count the rest of the nodes, without stopping a search that is done.
+    if (m_pLimits != nullptr) {
+        m_pLimits->AddNodes(m_uNodesSinceLimitCheck);
+        m_uNodesSinceLimitCheck = 0;
     }
     return cliques.size();
 }
 
-void MaxSubgraphAlgorithm::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+// Leaves the largest clique size as it was, so that the worker that computed
+// the order still records the clique found with it when it runs.
+void MaxSubgraphAlgorithm::ComputeInitialOrder(InitialOrder &initialOrder)
 {
-    nodeCount++;
-    vector<int> &vNewP(stackP[R.size()+1]);
-    vector<int> &vNewColors(stackColors[R.size()+1]);
-    vector<int> &vNewVertexOrder(stackOrder[R.size()+1]);
-
-////    bool &bEvaluatedHalfVertices = stackEvaluatedHalfVertices[R.size() + 1];
-////    stackEvaluatedHalfVertices[depth + 1] = (rand()%(depth+1) == depth);
-////    stackEvaluatedHalfVertices[depth + 1] = true;
-////    stackEvaluatedHalfVertices[depth + 1] = false;
-////    stackEvaluatedHalfVertices[depth + 1] = (depth<=2);
-
-////    size_t halfVertices(0);
-////    size_t index = P.size()+1;
-////    for (; index > 0; --index) {
-////        if (vColors[index-1] + R.size() <= m_uMaximumCliqueSize) {
-////            halfVertices = (index - 1) + 0.9*(P.size() - (index - 1));
-////            break;
-////        }
-////    }
-
-////    stackEvaluatedHalfVertices[depth + 1] = ((P.size() - index) > 50); //(depth<=2);
-    stackEvaluatedHalfVertices[depth + 1] = true;
-
-    size_t const uOriginalPSize(P.size());
-
-    if (nodeCount%10000 == 0) {
-        if (!m_bQuiet) {
-            cout << "Evaluated " << nodeCount << " nodes. " << Tools::GetTimeInSeconds(clock() - startTime) << endl;
-            PrintState();
-        }
-        if (m_TimeOut > 0 && (clock() - m_StartTime > m_TimeOut)) {
-            m_bTimedOut = true;
-            return;
-        }
-    }
+    size_t const uPresetCliqueSize(m_uMaximumCliqueSize);
+    InitializeOrder(initialOrder.P, initialOrder.vVertexOrder, initialOrder.vColors);
+    initialOrder.uCliqueSize = m_uMaximumCliqueSize;
+    m_uMaximumCliqueSize = uPresetCliqueSize;
+}
 
-    while (!P.empty()) {
-////    if (!stackEvaluatedHalfVertices[depth + 1]) {
-////        stackEvaluatedHalfVertices[depth + 1] = (rand()%(depth+1) == depth);
-////        stackEvaluatedHalfVertices[depth + 1] = (rand()%2 == 1);
-
-////        stackEvaluatedHalfVertices[depth+1] = (rand() % 20 == 1); ////!stackEvaluatedHalfVertices[depth+1];
-
-////        if (!stackEvaluatedHalfVertices[depth + 1]) {
-////            if (uOriginalPSize >= 100 && P.size() > 1 && vColors[P.size()-5] + R.size() <= m_uMaximumCliqueSize) {
-////                stackEvaluatedHalfVertices[depth + 1] = true;
-////            }
-////            size_t index = P.size();
-////            for (; index > 0; --index) {
-////                if (vColors[index-1] + R.size() <= m_uMaximumCliqueSize) {
-////                    halfVertices = (index - 1 + uOriginalPSize)/2;
-////                    break;
-////                }
-////            }
-////
-////            if (P.size() - index == 1) {
-////                stackEvaluatedHalfVertices[depth + 1] = true;
-////            }
-
-////            if (P.size() <= halfVertices) {
-////                stackEvaluatedHalfVertices[depth + 1] = true;
-////            }
-////////            else if (rand() % 2 == 1) { ////(P.size() - halfVertices) == 1) {
-////////                stackEvaluatedHalfVertices[R.size() + 1] = true;
-////////            }
-////            else if (rand() % P.size() <= index) {
-////                stackEvaluatedHalfVertices[depth + 1] = true;
-////            }
-////            else if (rand() % 2 == 1) {
-////                stackEvaluatedHalfVertices[depth+1] = stackEvaluatedHalfVertices[depth];
-////            }
-////        }
-
-////        cout << depth << ": P: ";
-////        for (int const p : P) {
-////            cout << p << " ";
-////        }
-////        cout << endl;
-
-        if (depth == 0) {
-            if (!m_bQuiet) {
-                cout << "Only " << P.size() << " more vertices to go! " << Tools::GetTimeInSeconds(clock() - startTime) << endl;
-            }
-        }
+bool MaxSubgraphAlgorithm::CheckSearchLimits()
+{
+    m_bSearchStopped = m_pLimits->Check(m_uNodesSinceLimitCheck);
+    m_uNodesSinceLimitCheck = 0;
+    m_uNodesPerLimitCheck = m_pLimits->NodesUntilNextCheck();
+    return m_bSearchStopped;
+}
 
-        int const largestColor(vColors.back());
-        if (R.size() + largestColor <= m_uMaximumCliqueSize) {
-            ProcessOrderBeforeReturn(vVertexOrder, P, vColors);
-            P.clear();
-            return;
-        }
+// The state of a serial search at the node it is about to enter, at uLevel:
+// the node count, the largest clique, R, and the frames from the root down.
+// The hooks keep no other state during the search, so this is enough to
+// continue it.
+void MaxSubgraphAlgorithm::WriteCheckpoint(size_t const uLevel, size_t const uNodeCount, list<list<int>> const &cliques, bool const bWait)
+{
+    vector<int64_t> &vState(m_vCheckpointState);
+    vState.clear();
+
+    auto const AppendVector = [&vState](vector<int> const &vValues) {
+        vState.push_back(vValues.size());
+        vState.insert(vState.end(), vValues.begin(), vValues.end());
+    };
+
+    vState.push_back(uNodeCount);
+    vState.push_back(m_uMaximumCliqueSize);
+    vState.push_back(m_uSearchBound);
+    vState.push_back(depth);
+    vState.push_back(uLevel);
+    AppendVector(R);
+    AppendVector(vector<int>(cliques.back().begin(), cliques.back().end()));
+
+    for (size_t level = 0; level <= uLevel; ++level) {
+        SearchFrame const &frame(m_vSearchFrames[level]);
+        AppendVector(frame.P);
+        AppendVector(frame.vColors);
+        AppendVector(frame.vVertexOrder);
+        vState.push_back(frame.uSplitIndex);
+        vState.push_back(frame.chosenVertex);
+    }
 
-        vColors.pop_back();
-        int const nextVertex(P.back()); P.pop_back();
-
-////        cout << depth << ": Choosing next vertex: " << nextVertex << endl;
-
-        GetNewOrder(vNewVertexOrder, vVertexOrder, P, nextVertex);
-
-        if (!vNewVertexOrder.empty()) {
-            vNewP.resize(vNewVertexOrder.size());
-            vNewColors.resize(vNewVertexOrder.size());
-            Color(vNewVertexOrder/* evaluation order */, vNewP /* color order */, vNewColors);
-#ifdef PREPRUNE
-            if (R.size() + vNewColors.back() > m_uMaximumCliqueSize) {
-                depth++;
-                RunRecursive(vNewP, vNewVertexOrder, cliques, vNewColors);
-                depth--;
-            }
-#else
-            depth++;
-            RunRecursive(vNewP, vNewVertexOrder, cliques, vNewColors);
-            depth--;
-#endif // PREPRUNE
-        } else if (R.size() > m_uMaximumCliqueSize) {
-            cliques.back().clear();
-            cliques.back().insert(cliques.back().end(), R.begin(), R.end());
-            ExecuteCallBacks(cliques.back());
-            m_uMaximumCliqueSize = R.size();
-            timeToLargestClique = clock() - startTime;
-        }
+    m_pCheckpoint->Write(vState, bWait);
+}
 
-        bool bPIsEmpty(P.empty());
-        ProcessOrderAfterRecursion(vVertexOrder, P, vColors, nextVertex);
-
-////        if (R.size() > m_uMaximumCliqueSize && bPIsEmpty && P.empty()) {
-////            cout << "ERROR!" << endl << flush;
-////        }
-
-        if (!bPIsEmpty && P.empty()) {
-            if (R.size() > m_uMaximumCliqueSize) {
-                cliques.back().clear();
-                cliques.back().insert(cliques.back().end(), R.begin(), R.end());
-                ExecuteCallBacks(cliques.back());
-                m_uMaximumCliqueSize = R.size();
-                timeToLargestClique = clock() - startTime;
-            }
+// Restores the state saved by WriteCheckpoint, returns false if there is no checkpoint.
+bool MaxSubgraphAlgorithm::ResumeFromCheckpoint(list<list<int>> &cliques)
+{
+    vector<int64_t> vState;
+    if (!m_pCheckpoint->Read(m_sResumeFileName, vState)) return false;
+
+    // the header matched this graph, but the counts and vertices in the
+    // state are checked against it too, before they size or index anything.
+    int64_t const numVertices(m_pCheckpoint->GetNumVertices());
+    size_t index(0);
+    auto const Next = [&vState, &index, this](int64_t const minValue, int64_t const maxValue) -> int64_t {
+        if (index >= vState.size() || vState[index] < minValue || vState[index] > maxValue) {
+            cerr << "ERROR: Checkpoint " << m_sResumeFileName << " is corrupt" << endl;
+            exit(1);
         }
+        return vState[index++];
+    };
+
+    // vertices are in [0, n), colors in [-1, n].
+    auto const ReadVector = [&Next, numVertices](vector<int> &vValues, int64_t const minValue, int64_t const maxValue) {
+        vValues.resize(Next(0, numVertices));
+        for (int &value : vValues) value = static_cast<int>(Next(minValue, maxValue));
+    };
+
+    nodeCount            = Next(0, INT64_MAX);
+    m_uMaximumCliqueSize = Next(0, numVertices);
+    m_uSearchBound       = Next(0, INT64_MAX);
+    depth                = static_cast<int>(Next(-1, numVertices));
+    m_uResumeLevel       = Next(0, numVertices);
+    m_uResumeEntryLevel  = R.size();
+    ReadVector(R, 0, numVertices - 1);
+
+    vector<int> vClique;
+    ReadVector(vClique, 0, numVertices - 1);
+    cliques.back().assign(vClique.begin(), vClique.end());
+    if (!vClique.empty()) ExecuteCallBacks(cliques.back());
+
+    ReserveSearchFrames(m_uResumeLevel + 2);
+    for (size_t level = 0; level <= m_uResumeLevel; ++level) {
+        SearchFrame &frame(m_vSearchFrames[level]);
+        ReadVector(frame.P, 0, numVertices - 1);
+        ReadVector(frame.vColors, -1, numVertices);
+        ReadVector(frame.vVertexOrder, 0, numVertices - 1);
+        frame.uSplitIndex  = Next(0, numVertices);
+        frame.chosenVertex = static_cast<int>(Next(-1, numVertices - 1));
     }
 
-    ProcessOrderBeforeReturn(vVertexOrder, P, vColors);
-    P.clear();
+    m_bResuming = true;
+    return true;
+}
+
+// Moves the existing frames if it grows, so references to them are invalidated.
+void MaxSubgraphAlgorithm::ReserveSearchFrames(size_t const uNumFrames)
+{
+    if (m_vSearchFrames.size() >= uNumFrames) return;
+    m_vSearchFrames.resize(uNumFrames);
+    stackEvaluatedHalfVertices.resize(uNumFrames + 1);
+}
 
-    vNewColors.clear();
-    vNewP.clear();
+// The generic search, with virtual calls to the search hooks. Derived
+// algorithms override RunRecursive with their own instantiation, see
+// RunRecursiveStatic.
+void MaxSubgraphAlgorithm::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<MaxSubgraphAlgorithm>(P, vVertexOrder, cliques, vColors);
 }
 
 
@@ -243,7 +377,7 @@ void MaxSubgraphAlgorithm::PrintState() const
 {
     cout << "(";
     for (size_t index = 0; index <= R.size(); ++index) {
-        cout << stackP[index].size();
+        cout << m_vSearchFrames[index].P.size();
         if (index != R.size()) cout << ", ";
     }
     cout << ")" << endl << flush;
@@ -18,16 +18,54 @@
 
 #include "Algorithm.h"
 #include "IndependentSetColoringStrategy.h"
+#include "ParallelSearchState.h"
+#include "SearchLimits.h"
+#include "SearchCheckpoint.h"
+#include "SearchStatistics.h"
+#include "KernelInputs.h"
+#include "PerfCounters.h"
+#include "MaxSatBound.h"
+#include "Tools.h"
 
 #include <vector>
 #include <list>
 #include <ctime>
+#include <iostream>
+#include <algorithm>
+#include <chrono>
 
 ////#define PREPRUNE
 ////#define REMOVE_ISOLATES_BEFORE_ONLY
 ////#define ALWAYS_REMOVE_ISOLATES_AFTER
 ////#define NO_ISOLATES_P_LEFT_10
 
+// One level of the search: the candidates P (in color order), their colors,
+// the evaluation order, and the branch being evaluated.
+class SearchFrame
+{
+public:
+    SearchFrame() : P(), vColors(), vVertexOrder(), uSplitIndex(0), chosenVertex(-1) {}
+
+    std::vector<int> P;
+    std::vector<int> vColors;
+    std::vector<int> vVertexOrder;
+    size_t uSplitIndex; // branches before this index were given to another worker
+    int    chosenVertex;
+};
+
+// The initial order and coloring of the whole graph, and the size of the
+// clique found while computing them, as InitializeOrder leaves them.
+class InitialOrder
+{
+public:
+    InitialOrder() : P(), vVertexOrder(), vColors(), uCliqueSize(0) {}
+
+    std::vector<int> P;
+    std::vector<int> vVertexOrder;
+    std::vector<int> vColors;
+    size_t uCliqueSize;
+};
+
 class MaxSubgraphAlgorithm : public Algorithm
 {
 public:
@@ -40,6 +78,10 @@ public:
     virtual void Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors) = 0;
 
     virtual void InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors) = 0;
+
+    // sets up what the search derives from the initial order, which may have
+    // been computed by another copy of the algorithm.
+    virtual void AdoptInitialOrder(std::vector<int> const &vVertexOrder) {}
     virtual void GetNewOrder(std::vector<int> &vNewVertexOrder, std::vector<int> &vVertexOrder, std::vector<int> const &P, int const chosenVertex) = 0;
     virtual void ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex) = 0;
 
@@ -47,28 +89,90 @@ public:
 
     virtual void RunRecursive(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
 
+    // The branch and bound search, with the search hooks of Derived called
+    // directly instead of through the vtable, so that they can be inlined.
+    // Each algorithm overrides RunRecursive with its own instantiation; an
+    // algorithm that overrides any hook must do the same.
+    template <class Derived>
+    void RunRecursiveStatic(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
+
+    // the search, compiled with or without the search statistics, the
+    // sampling of kernel inputs, and the phase markers of the perf profile.
+    template <class Derived, bool bInstrumented>
+    void RunSearch(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
+
+    // the strategy whose Repair calls are counted in the search statistics.
+    virtual ColoringStrategy const *GetColoringStrategy() const { return nullptr; }
+
     virtual void SetQuiet(bool const quiet) { m_bQuiet = quiet; }
 
     virtual void PrintState() const;
 
     virtual void SetNodeCount(size_t const count) { nodeCount = count; }
-    virtual size_t GetNodeCount() { return nodeCount; }
+    virtual size_t GetNodeCount() const { return nodeCount; }
+    virtual double GetTimeToLargestCliqueInSeconds() const { return static_cast<double>(timeToLargestClique)/CLOCKS_PER_SEC; }
 
     void SetR(std::vector<int> const &newR) { R = newR; }
     void SetMaximumCliqueSize(size_t const newCliqueSize) { m_uMaximumCliqueSize = newCliqueSize; }
 
     void SetOnlyVertex(int const vertex) { m_iOnlyVertex = vertex; }
 
-    void SetTimeOutInSeconds(double const timeout) { m_TimeOut = timeout*CLOCKS_PER_SEC; }
+    bool GetSearchStopped() const { return m_bSearchStopped; }
+
+    // while stopped, the bound also covers the branches left unevaluated.
+    virtual size_t GetUpperBound() const { return std::max(m_uMaximumCliqueSize, m_uSearchBound); }
+
+    // write the search state to pCheckpoint as the search runs, and if
+    // resumeFileName names a checkpoint, continue the search saved in it.
+    void SetCheckpoint(SearchCheckpoint *pCheckpoint, std::string const &resumeFileName) { m_pCheckpoint = pCheckpoint; m_sResumeFileName = resumeFileName; }
+
+    // sample the inputs of the coloring and filtering kernels into pKernelInputs.
+    void SetKernelInputs(KernelInputs *pKernelInputs) { m_pKernelInputs = pKernelInputs; }
+
+    // try pMaxSatBound on the children that the number of colors doesn't prune.
+    void SetMaxSatBound(MaxSatBound *pMaxSatBound) { m_pMaxSatBound = pMaxSatBound; }
 
-    bool GetTimedOut() const { return m_bTimedOut; }
+    void SetParallelSearchState(ParallelSearchState *pState, int const workerIndex) { m_pParallelState = pState; m_iWorkerIndex = workerIndex; }
+
+    // compute the initial order once, and start each worker from a copy.
+    void ComputeInitialOrder(InitialOrder &initialOrder);
+    void SetInitialOrder(InitialOrder const *pInitialOrder) { m_pInitialOrder = pInitialOrder; }
+
+    void RunStolenTasks(std::list<std::list<int>> &cliques);
+
+    size_t GetStealCount() const    { return m_uStealCount; }
+    size_t GetDonationCount() const { return m_uDonationCount; }
 
 protected:
+    void RecordClique(std::list<std::list<int>> &cliques);
+    void PublishMaximumCliqueSize();
+    bool ClaimRootBranch();
+    size_t DonateBranches(std::vector<int> const &P, std::vector<int> const &vVertexOrder, std::vector<int> const &vColors);
+    void ReserveSearchFrames(size_t const uNumFrames);
+
+    void WriteCheckpoint(size_t const uLevel, size_t const uNodeCount, std::list<std::list<int>> const &cliques, bool const bWait);
+    bool ResumeFromCheckpoint(std::list<std::list<int>> &cliques);
+
+    bool CheckSearchLimits();
+
+    // count a search node against the search limits, true if the search must stop.
+    bool SearchLimitReached()
+    {
+        if (m_pLimits == nullptr || ++m_uNodesSinceLimitCheck < m_uNodesPerLimitCheck) return false;
+        return CheckSearchLimits();
+    }
+
+    // pick up larger cliques found by other workers, so that they prune here too.
+    void SynchronizeMaximumCliqueSize()
+    {
+        if (m_pParallelState == nullptr) return;
+        size_t const uSharedCliqueSize(m_pParallelState->m_uMaximumCliqueSize.load(std::memory_order_relaxed));
+        if (uSharedCliqueSize > m_uMaximumCliqueSize) m_uMaximumCliqueSize = uSharedCliqueSize;
+    }
+
     size_t m_uMaximumCliqueSize;
     std::vector<int> R;
-    std::vector<std::vector<int>> stackP;
-    std::vector<std::vector<int>> stackColors;
-    std::vector<std::vector<int>> stackOrder;
+    std::vector<SearchFrame> m_vSearchFrames; // indexed by R.size()
     size_t nodeCount;
     int depth;
     clock_t startTime;
@@ -77,8 +181,346 @@ protected:
     std::vector<bool> stackEvaluatedHalfVertices;
 ////    bool m_bInvert;
     int m_iOnlyVertex;
-    clock_t m_TimeOut;
-    clock_t m_StartTime;
-    bool    m_bTimedOut;
+    SearchLimits *m_pLimits;
+    size_t  m_uNodesSinceLimitCheck;
+    size_t  m_uNodesPerLimitCheck;
+    bool    m_bSearchStopped;
+    size_t  m_uSearchBound; // bound on the branches of the entry node not yet evaluated
+    SearchStatistics *m_pStatistics;
+    KernelInputs *m_pKernelInputs;
+    MaxSatBound *m_pMaxSatBound;
+    SearchCheckpoint *m_pCheckpoint;
+    std::vector<int64_t> m_vCheckpointState;
+    std::string m_sResumeFileName;
+    bool    m_bResuming;    // the next search starts at m_uResumeLevel, not the entry node
+    size_t  m_uResumeEntryLevel;
+    size_t  m_uResumeLevel;
+    ParallelSearchState *m_pParallelState;
+    int     m_iWorkerIndex;
+    InitialOrder const *m_pInitialOrder;
+    size_t  m_uRootBranch;
+    size_t  m_uStealCount;
+    size_t  m_uDonationCount;
+    std::vector<bool> m_vbInTask;
+};
+
+// Calls the search hooks of AlgorithmType without virtual dispatch.
+template <class AlgorithmType>
+struct SearchHooks
+{
+    static void Color(AlgorithmType &algorithm, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
+    {
+        algorithm.AlgorithmType::Color(vVertexOrder, vVerticesToReorder, vColors);
+    }
+
+    static void GetNewOrder(AlgorithmType &algorithm, std::vector<int> &vNewVertexOrder, std::vector<int> &vVertexOrder, std::vector<int> const &P, int const chosenVertex)
+    {
+        algorithm.AlgorithmType::GetNewOrder(vNewVertexOrder, vVertexOrder, P, chosenVertex);
+    }
+
+    static void ProcessOrderAfterRecursion(AlgorithmType &algorithm, std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex)
+    {
+        algorithm.AlgorithmType::ProcessOrderAfterRecursion(vVertexOrder, P, vColors, chosenVertex);
+    }
+
+    static void ProcessOrderBeforeReturn(AlgorithmType &algorithm, std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors)
+    {
+        algorithm.AlgorithmType::ProcessOrderBeforeReturn(vVertexOrder, P, vColors);
+    }
+};
+
+// The generic search calls the hooks through the vtable.
+template <>
+struct SearchHooks<MaxSubgraphAlgorithm>
+{
+    static void Color(MaxSubgraphAlgorithm &algorithm, std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
+    {
+        algorithm.Color(vVertexOrder, vVerticesToReorder, vColors);
+    }
+
+    static void GetNewOrder(MaxSubgraphAlgorithm &algorithm, std::vector<int> &vNewVertexOrder, std::vector<int> &vVertexOrder, std::vector<int> const &P, int const chosenVertex)
+    {
+        algorithm.GetNewOrder(vNewVertexOrder, vVertexOrder, P, chosenVertex);
+    }
+
+    static void ProcessOrderAfterRecursion(MaxSubgraphAlgorithm &algorithm, std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex)
+    {
+        algorithm.ProcessOrderAfterRecursion(vVertexOrder, P, vColors, chosenVertex);
+    }
+
+    static void ProcessOrderBeforeReturn(MaxSubgraphAlgorithm &algorithm, std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors)
+    {
+        algorithm.ProcessOrderBeforeReturn(vVertexOrder, P, vColors);
+    }
 };
+
+// Only a search that collects statistics, kernel inputs, or a perf profile pays for them.
+template <class Derived>
+void MaxSubgraphAlgorithm::RunRecursiveStatic(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors)
+{
+    if (m_pStatistics != nullptr || m_pKernelInputs != nullptr || PerfProfile::Active() != nullptr) {
+        RunSearch<Derived, true>(P, vVertexOrder, cliques, vColors);
+    } else {
+        RunSearch<Derived, false>(P, vVertexOrder, cliques, vColors);
+    }
+}
+
+// The search is iterative: each search node keeps its candidates, colors, and
+// evaluation order in the frame at index R.size(), along with the branch it
+// is evaluating, so that it can be resumed when that branch is done.
+template <class Derived, bool bInstrumented>
+void MaxSubgraphAlgorithm::RunSearch(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors)
+{
+    Derived &algorithm(static_cast<Derived&>(*this));
+    SearchStatistics *pStatistics(bInstrumented ? m_pStatistics : nullptr);
+    ColoringStrategy const *pColoringStrategy(pStatistics != nullptr ? GetColoringStrategy() : nullptr);
+    PerfProfile *pProfile(bInstrumented ? PerfProfile::Active() : nullptr);
+
+    // a resumed search enters below the entry node, with R restored to match.
+    size_t const uEntryLevel(m_bResuming ? m_uResumeEntryLevel : R.size());
+
+    // the search works in the frames, move the entry node in if it isn't
+    // there. Decided before reserving, which may move the frames P is in.
+    bool const bSwapEntry(uEntryLevel >= m_vSearchFrames.size() || &P != &m_vSearchFrames[uEntryLevel].P);
+    ReserveSearchFrames(uEntryLevel + 2);
+    if (bSwapEntry) {
+        m_vSearchFrames[uEntryLevel].P.swap(P);
+        m_vSearchFrames[uEntryLevel].vColors.swap(vColors);
+        m_vSearchFrames[uEntryLevel].vVertexOrder.swap(vVertexOrder);
+    }
+
+    size_t uLevel(uEntryLevel);
+    if (m_bResuming) {
+        m_bResuming = false;
+        uLevel = m_uResumeLevel;
+    }
+
+    bool bEnteringNode(true);
+    bool bBranchDone(false);
+
+    while (true) {
+        // never needed when the frames are sized by the initial coloring.
+        if (m_vSearchFrames.size() < uLevel + 2) ReserveSearchFrames(uLevel + 2);
+
+        SearchFrame &frame(m_vSearchFrames[uLevel]);
+        SearchFrame &newFrame(m_vSearchFrames[uLevel + 1]);
+        std::vector<int> &vCurrentP(frame.P);
+        std::vector<int> &vCurrentColors(frame.vColors);
+        std::vector<int> &vCurrentOrder(frame.vVertexOrder);
+        std::vector<int> &vNewP(newFrame.P);
+        std::vector<int> &vNewColors(newFrame.vColors);
+        std::vector<int> &vNewVertexOrder(newFrame.vVertexOrder);
+
+        bool bDescend(false);
+        bool bStopSearch(false);
+
+        if (bEnteringNode) {
+            bEnteringNode = false;
+
+            if (m_pCheckpoint != nullptr && nodeCount%64 == 0 && m_pCheckpoint->Due()) {
+                WriteCheckpoint(uLevel, nodeCount, cliques, false /* write in the background */);
+            }
+
+            nodeCount++;
+
+            if (bInstrumented && pStatistics != nullptr) {
+                SearchStatistics::Depth &statistics(pStatistics->AtDepth(depth));
+                statistics.nodes++;
+                statistics.candidates += vCurrentP.size();
+            }
+
+            bStopSearch = SearchLimitReached();
+
+            // save the search, so that a resumed search enters this node again.
+            if (bStopSearch && m_pCheckpoint != nullptr) {
+                WriteCheckpoint(uLevel, nodeCount - 1, cliques, true /* wait for the write */);
+            }
+
+////            bool &bEvaluatedHalfVertices = stackEvaluatedHalfVertices[R.size() + 1];
+////            stackEvaluatedHalfVertices[depth + 1] = (rand()%(depth+1) == depth);
+////            stackEvaluatedHalfVertices[depth + 1] = true;
+////            stackEvaluatedHalfVertices[depth + 1] = false;
+////            stackEvaluatedHalfVertices[depth + 1] = (depth<=2);
+
+////            size_t halfVertices(0);
+////            size_t index = vCurrentP.size()+1;
+////            for (; index > 0; --index) {
+////                if (vCurrentColors[index-1] + R.size() <= m_uMaximumCliqueSize) {
+////                    halfVertices = (index - 1) + 0.9*(vCurrentP.size() - (index - 1));
+////                    break;
+////                }
+////            }
+
+////            stackEvaluatedHalfVertices[depth + 1] = ((vCurrentP.size() - index) > 50); //(depth<=2);
+            stackEvaluatedHalfVertices[depth + 1] = true;
+
+            frame.uSplitIndex = 0; // branches before this index were given to another worker
+
+            if (nodeCount%10000 == 0) {
+                if (!m_bQuiet) {
+                    std::cout << "Evaluated " << nodeCount << " nodes. " << Tools::GetTimeInSeconds(clock() - startTime) << std::endl;
+                    PrintState();
+                }
+            }
+        }
+
+        while (!bStopSearch) {
+            if (bBranchDone) {
+                bBranchDone = false;
+
+                bool bPIsEmpty(vCurrentP.empty());
+                SearchHooks<Derived>::ProcessOrderAfterRecursion(algorithm, vCurrentOrder, vCurrentP, vCurrentColors, frame.chosenVertex);
+
+////                if (R.size() > m_uMaximumCliqueSize && bPIsEmpty && vCurrentP.empty()) {
+////                    std::cout << "ERROR!" << std::endl << flush;
+////                }
+
+                if (!bPIsEmpty && vCurrentP.empty()) {
+                    if (R.size() > m_uMaximumCliqueSize) {
+                        RecordClique(cliques);
+                    }
+                }
+            }
+
+            if (vCurrentP.size() <= frame.uSplitIndex) {
+                SearchHooks<Derived>::ProcessOrderBeforeReturn(algorithm, vCurrentOrder, vCurrentP, vCurrentColors);
+                vCurrentP.clear();
+
+                vNewColors.clear();
+                vNewP.clear();
+                break;
+            }
+
+////            std::cout << depth << ": P: ";
+////            for (int const p : vCurrentP) {
+////                std::cout << p << " ";
+////            }
+////            std::cout << std::endl;
+
+            if (depth == 0) {
+                if (!m_bQuiet) {
+                    std::cout << "Only " << vCurrentP.size() << " more vertices to go! " << Tools::GetTimeInSeconds(clock() - startTime) << std::endl;
+                }
+            }
+
+            SynchronizeMaximumCliqueSize();
+
+            int const largestColor(vCurrentColors.back());
+            if (R.size() + largestColor <= m_uMaximumCliqueSize) {
+                if (bInstrumented && pStatistics != nullptr) {
+                    SearchStatistics::Depth &statistics(pStatistics->AtDepth(depth));
+                    statistics.boundPrunes++;
+                    statistics.prunedBranches += vCurrentP.size();
+                }
+                SearchHooks<Derived>::ProcessOrderBeforeReturn(algorithm, vCurrentOrder, vCurrentP, vCurrentColors);
+                vCurrentP.clear();
+                break;
+            }
+
+            if (uLevel == uEntryLevel) {
+                m_uSearchBound = R.size() + largestColor;
+            }
+
+            if (depth > 0 && frame.uSplitIndex == 0 && m_pParallelState != nullptr && m_pParallelState->IsHungry()) {
+                frame.uSplitIndex = DonateBranches(vCurrentP, vCurrentOrder, vCurrentColors);
+            }
+
+            vCurrentColors.pop_back();
+            int const nextVertex(vCurrentP.back()); vCurrentP.pop_back();
+            frame.chosenVertex = nextVertex;
+
+////            std::cout << depth << ": Choosing next vertex: " << nextVertex << std::endl;
+
+            // the next frame only holds vertices from this node's order, so
+            // size its buffers to that instead of letting them double.
+            if (vNewVertexOrder.capacity() < vCurrentOrder.size()) {
+                vNewVertexOrder.reserve(vCurrentOrder.size());
+                vNewP.reserve(vCurrentOrder.size());
+                vNewColors.reserve(vCurrentOrder.size());
+            }
+
+            std::chrono::steady_clock::time_point startNewOrder;
+            if (bInstrumented && pStatistics != nullptr) startNewOrder = std::chrono::steady_clock::now();
+
+            {
+                PerfPhase const phase(pProfile, PerfProfile::Filtering);
+                SearchHooks<Derived>::GetNewOrder(algorithm, vNewVertexOrder, vCurrentOrder, vCurrentP, nextVertex);
+            }
+
+            if (bInstrumented && pStatistics != nullptr) {
+                pStatistics->AtDepth(depth).newOrderSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - startNewOrder).count();
+            }
+
+            if (depth == 0 && !ClaimRootBranch()) {
+                // another worker evaluates this branch, only update the order.
+            } else if (!vNewVertexOrder.empty()) {
+                vNewP.resize(vNewVertexOrder.size());
+                vNewColors.resize(vNewVertexOrder.size());
+                // the entry node's order is the whole graph, sample below it.
+                if (bInstrumented && m_pKernelInputs != nullptr && uLevel > uEntryLevel && m_pKernelInputs->Due()) {
+                    m_pKernelInputs->Add(vCurrentOrder, nextVertex, vNewVertexOrder, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()));
+                }
+
+                PerfPhase const phase(pProfile, PerfProfile::Coloring);
+                if (bInstrumented && pStatistics != nullptr) {
+                    size_t const uRepairAttempts(pColoringStrategy != nullptr ? pColoringStrategy->GetRepairAttempts() : 0);
+                    size_t const uRepairSuccesses(pColoringStrategy != nullptr ? pColoringStrategy->GetRepairSuccesses() : 0);
+                    std::chrono::steady_clock::time_point const startColor(std::chrono::steady_clock::now());
+
+                    SearchHooks<Derived>::Color(algorithm, vNewVertexOrder/* evaluation order */, vNewP /* color order */, vNewColors);
+
+                    SearchStatistics::Depth &statistics(pStatistics->AtDepth(depth));
+                    statistics.colorSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - startColor).count();
+                    if (pColoringStrategy != nullptr) {
+                        statistics.repairAttempts  += pColoringStrategy->GetRepairAttempts() - uRepairAttempts;
+                        statistics.repairSuccesses += pColoringStrategy->GetRepairSuccesses() - uRepairSuccesses;
+                    }
+                } else {
+                    SearchHooks<Derived>::Color(algorithm, vNewVertexOrder/* evaluation order */, vNewP /* color order */, vNewColors);
+                }
+#ifdef PREPRUNE
+                bDescend = (R.size() + vNewColors.back() > m_uMaximumCliqueSize);
+#else
+                bDescend = true;
+#endif // PREPRUNE
+                if (m_pMaxSatBound != nullptr && R.size() + vNewColors.back() > m_uMaximumCliqueSize &&
+                    m_pMaxSatBound->Prunes(vNewP, vNewColors, static_cast<int>(m_uMaximumCliqueSize) - static_cast<int>(R.size()))) {
+                    bDescend = false;
+                }
+            } else if (R.size() > m_uMaximumCliqueSize) {
+                RecordClique(cliques);
+            }
+
+            if (bDescend) break;
+            bBranchDone = true;
+        }
+
+        // leave the frames as they are, the search is over.
+        if (bStopSearch) break;
+
+        if (bDescend) {
+            // evaluate the branch in the next frame, and finish it on return.
+            depth++;
+            uLevel++;
+            bEnteringNode = true;
+            continue;
+        }
+
+        if (uLevel == uEntryLevel) {
+            m_uSearchBound = 0; // every branch was evaluated
+            break;
+        }
+
+        depth--;
+        uLevel--;
+        bBranchDone = true;
+    }
+
+    if (bSwapEntry) {
+        m_vSearchFrames[uEntryLevel].P.swap(P);
+        m_vSearchFrames[uEntryLevel].vColors.swap(vColors);
+        m_vSearchFrames[uEntryLevel].vVertexOrder.swap(vVertexOrder);
+    }
+}
+
 #endif // MAX_SUBGRAPH_ALGORITHM_H
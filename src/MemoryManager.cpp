@@ -15,6 +15,8 @@
 
 #include "MemoryManager.h"
 
+#include <sys/resource.h>
+
 /*! \file MemoryManager.cpp
 
     \brief defines malloc and calloc wrapper functions so that we don't
@@ -41,3 +43,10 @@
 
 
 #endif
+
+size_t PeakResidentSetSizeInKB()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return static_cast<size_t>(usage.ru_maxrss); // kilobytes on Linux
+}
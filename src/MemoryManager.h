@@ -35,6 +35,13 @@
     \endhtmlonly
 */
 
+/*! \brief The peak resident set size of this process.
+
+    \return the peak resident set size in kilobytes, or 0 if it is unavailable.
+*/
+
+size_t PeakResidentSetSizeInKB();
+
 #ifdef MEMORY_DEBUG
 #include <cstdio.h>
 
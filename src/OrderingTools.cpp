@@ -26,6 +26,9 @@
 
 using namespace std;
 
+// the sparse orderings examine at most this many vertices when breaking ties.
+#define MAX_TIE_BREAK_CANDIDATES 256
+
 void OrderingTools::InitialOrderingMCQ(vector<vector<char>> const &adjacencyMatrix, vector<int> &vOrderedVertices, vector<int> &vColoring)
 {
     size_t maxDegree(0);
@@ -355,10 +358,14 @@ void OrderingTools::InitialOrderingMCR(vector<vector<int>> const &adjacencyArray
 
                     return;
                 } else {
-                    // break ties by neighborhood-degree
+                    // break ties by neighborhood-degree, among the first few
+                    // candidates, so that large sparse graphs with many
+                    // vertices of equal degree aren't ordered in quadratic time.
                     size_t minNeighborhoodDegree(ULONG_MAX);
                     int    chosenVertex=verticesByDegree[currentDegree].front();
+                    size_t numCandidates(0);
                     for (int const candidate : verticesByDegree[currentDegree]) {
+                        if (++numCandidates > MAX_TIE_BREAK_CANDIDATES) break;
                         size_t neighborhoodDegree(0);
                         for (int const neighbor : adjacencyArray[candidate]) {
                             if (degree[neighbor] != -1) {
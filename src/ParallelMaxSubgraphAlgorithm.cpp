@@ -0,0 +1,141 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "ParallelMaxSubgraphAlgorithm.h"
+
+#include <thread>
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+ParallelMaxSubgraphAlgorithm::ParallelMaxSubgraphAlgorithm(function<MaxSubgraphAlgorithm*()> const &createWorker, int const numThreads, bool const workStealing)
+: Algorithm("")
+, m_vWorkers()
+, m_State(numThreads, workStealing)
+, m_vWorkerStatistics(numThreads)
+, m_InitialOrder()
+, m_uBestWorker(0)
+{
+    for (int thread = 0; thread < numThreads; ++thread) {
+        MaxSubgraphAlgorithm *pWorker(createWorker());
+        pWorker->SetQuiet(true);
+        pWorker->SetParallelSearchState(&m_State, thread);
+        m_vWorkers.push_back(pWorker);
+    }
+
+    SetName(m_vWorkers.front()->GetName());
+}
+
+ParallelMaxSubgraphAlgorithm::~ParallelMaxSubgraphAlgorithm()
+{
+    if (!GetQuiet()) {
+        cerr << "Threads            : " << m_vWorkers.size() << endl;
+        cerr << "Largest Clique     : " << m_State.m_uMaximumCliqueSize.load() << endl;
+        cerr << "Search Nodes       : " << GetNodeCount() << endl;
+        for (size_t index = 0; index < m_vWorkers.size(); ++index) {
+            cerr << "  Thread " << index << " Nodes   : " << m_vWorkers[index]->GetNodeCount();
+            if (m_State.m_bWorkStealing) {
+                cerr << ", Steals : " << m_vWorkers[index]->GetStealCount();
+                cerr << ", Donations : " << m_vWorkers[index]->GetDonationCount();
+            }
+            cerr << endl;
+        }
+    }
+
+    for (MaxSubgraphAlgorithm *pWorker : m_vWorkers) {
+        delete pWorker;
+    }
+    m_vWorkers.clear();
+}
+
+long ParallelMaxSubgraphAlgorithm::Run(list<list<int>> &cliques)
+{
+    vector<list<list<int>>> vWorkerCliques(m_vWorkers.size());
+    vector<thread> vThreads;
+
+    // each worker counts its own search tree, they are merged when done.
+    for (size_t index = 0; index < m_vWorkers.size(); ++index) {
+        m_vWorkers[index]->SetSearchLimits(GetSearchLimits());
+        if (GetSearchStatistics() != nullptr) m_vWorkers[index]->SetSearchStatistics(&m_vWorkerStatistics[index]);
+    }
+
+    // the initial order is the same for every worker, so it is computed once,
+    // and each worker starts from a copy of it.
+    m_vWorkers.front()->ComputeInitialOrder(m_InitialOrder);
+    for (MaxSubgraphAlgorithm *pWorker : m_vWorkers) {
+        pWorker->SetInitialOrder(&m_InitialOrder);
+    }
+
+    for (size_t index = 0; index < m_vWorkers.size(); ++index) {
+        vThreads.push_back(thread([this, &vWorkerCliques, index]() {
+            m_vWorkers[index]->Run(vWorkerCliques[index]);
+            m_vWorkers[index]->RunStolenTasks(vWorkerCliques[index]);
+        }));
+    }
+
+    for (thread &workerThread : vThreads) {
+        workerThread.join();
+    }
+
+    if (GetSearchStatistics() != nullptr) {
+        for (SearchStatistics const &statistics : m_vWorkerStatistics) {
+            GetSearchStatistics()->Merge(statistics);
+        }
+    }
+
+    // each worker only holds the largest clique it found itself.
+    cliques.push_back(list<int>());
+    for (size_t index = 0; index < vWorkerCliques.size(); ++index) {
+        list<list<int>> const &workerCliques(vWorkerCliques[index]);
+        if (!workerCliques.empty() && workerCliques.back().size() > cliques.back().size()) {
+            cliques.back() = workerCliques.back();
+            m_uBestWorker = index;
+        }
+    }
+
+    ExecuteCallBacks(cliques.back());
+
+    return cliques.size();
+}
+
+size_t ParallelMaxSubgraphAlgorithm::GetNodeCount() const
+{
+    size_t nodeCount(0);
+    for (MaxSubgraphAlgorithm *pWorker : m_vWorkers) {
+        nodeCount += pWorker->GetNodeCount();
+    }
+    return nodeCount;
+}
+
+double ParallelMaxSubgraphAlgorithm::GetTimeToLargestCliqueInSeconds() const
+{
+    return m_vWorkers[m_uBestWorker]->GetTimeToLargestCliqueInSeconds();
+}
+
+chrono::steady_clock::time_point ParallelMaxSubgraphAlgorithm::GetTimeOfLargestClique() const
+{
+    return m_vWorkers[m_uBestWorker]->GetTimeOfLargestClique();
+}
+
+// each worker bounds the branches it left, and tasks may be left queued.
+size_t ParallelMaxSubgraphAlgorithm::GetUpperBound() const
+{
+    size_t uBound(max(m_State.m_uMaximumCliqueSize.load(), m_State.QueuedTaskBound()));
+    for (MaxSubgraphAlgorithm *pWorker : m_vWorkers) {
+        uBound = max(uBound, pWorker->GetUpperBound());
+    }
+    return uBound;
+}
@@ -0,0 +1,53 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef PARALLEL_MAX_SUBGRAPH_ALGORITHM_H
+#define PARALLEL_MAX_SUBGRAPH_ALGORITHM_H
+
+#include "Algorithm.h"
+#include "MaxSubgraphAlgorithm.h"
+
+#include <vector>
+#include <list>
+#include <functional>
+
+// Runs one copy of a MaxSubgraphAlgorithm per thread. Each worker has its own
+// search stacks and coloring scratch space; the workers start from one
+// initial order, split the root branches between them, and share the size of
+// the largest clique found. With work stealing, busy workers also split off
+// the remaining branches of deeper nodes for idle workers to evaluate.
+class ParallelMaxSubgraphAlgorithm : public Algorithm
+{
+public:
+    ParallelMaxSubgraphAlgorithm(std::function<MaxSubgraphAlgorithm*()> const &createWorker, int const numThreads, bool const workStealing);
+    virtual ~ParallelMaxSubgraphAlgorithm();
+
+    virtual long Run(std::list<std::list<int>> &cliques);
+
+    virtual size_t GetNodeCount() const;
+    virtual double GetTimeToLargestCliqueInSeconds() const;
+    virtual std::chrono::steady_clock::time_point GetTimeOfLargestClique() const;
+
+    virtual size_t GetUpperBound() const;
+
+protected:
+    std::vector<MaxSubgraphAlgorithm*> m_vWorkers;
+    ParallelSearchState m_State;
+    std::vector<SearchStatistics> m_vWorkerStatistics;
+    InitialOrder m_InitialOrder;
+    size_t m_uBestWorker; // the worker that found the largest clique
+};
+
+#endif //PARALLEL_MAX_SUBGRAPH_ALGORITHM_H
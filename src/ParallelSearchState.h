@@ -0,0 +1,141 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef PARALLEL_SEARCH_STATE_H
+#define PARALLEL_SEARCH_STATE_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+
+// An unexplored part of a search node, handed from one worker to another: the
+// clique R built so far, and the candidates P (in color order), their colors,
+// and the evaluation order, as they would be on the stack at depth.
+class SearchTask
+{
+public:
+    SearchTask() : R(), P(), vColors(), vVertexOrder(), depth(0) {}
+
+    std::vector<int> R;
+    std::vector<int> P;
+    std::vector<int> vColors;
+    std::vector<int> vVertexOrder;
+    int depth;
+};
+
+// State shared by the workers of a parallel search: the size of the largest
+// clique found by any worker, the next root branch left to evaluate, and, for
+// work stealing, one task deque per worker.
+//
+// A worker pushes and pops its own tasks at the back of its deque, and steals
+// from the front of the others, where the shallowest (largest) tasks are.
+class ParallelSearchState
+{
+public:
+    ParallelSearchState(int const numWorkers = 1, bool const workStealing = false)
+    : m_uMaximumCliqueSize(0)
+    , m_uNextRootBranch(0)
+    , m_bWorkStealing(workStealing)
+    , m_iNumWorkers(numWorkers)
+    , m_iNumBusyWorkers(numWorkers)
+    , m_iNumQueuedTasks(0)
+    , m_vTaskQueues()
+    {
+        for (int worker = 0; worker < numWorkers; ++worker) {
+            m_vTaskQueues.emplace_back(new TaskQueue());
+        }
+    }
+
+    // only donate work when some worker is waiting for it.
+    bool IsHungry() const
+    {
+        return m_bWorkStealing &&
+               m_iNumQueuedTasks.load(std::memory_order_relaxed) < m_iNumWorkers - m_iNumBusyWorkers.load(std::memory_order_relaxed);
+    }
+
+    void PushTask(int const worker, SearchTask &task)
+    {
+        TaskQueue &queue(*m_vTaskQueues[worker]);
+        std::lock_guard<std::mutex> lock(queue.m_Mutex);
+        queue.m_Tasks.push_back(std::move(task));
+        m_iNumQueuedTasks++;
+    }
+
+    // on success, the calling worker is counted as busy again.
+    bool PopTask(int const worker, SearchTask &task, bool &bStolen)
+    {
+        for (int offset = 0; offset < m_iNumWorkers; ++offset) {
+            int const victim((worker + offset) % m_iNumWorkers);
+            TaskQueue &queue(*m_vTaskQueues[victim]);
+            std::lock_guard<std::mutex> lock(queue.m_Mutex);
+            if (queue.m_Tasks.empty()) continue;
+
+            m_iNumBusyWorkers++;
+            if (victim == worker) {
+                task = std::move(queue.m_Tasks.back());
+                queue.m_Tasks.pop_back();
+            } else {
+                task = std::move(queue.m_Tasks.front());
+                queue.m_Tasks.pop_front();
+            }
+            m_iNumQueuedTasks--;
+            bStolen = (victim != worker);
+            return true;
+        }
+        return false;
+    }
+
+    // a bound on the cliques in tasks that were never evaluated.
+    size_t QueuedTaskBound() const
+    {
+        size_t uBound(0);
+        for (std::unique_ptr<TaskQueue> const &pQueue : m_vTaskQueues) {
+            std::lock_guard<std::mutex> lock(pQueue->m_Mutex);
+            for (SearchTask const &task : pQueue->m_Tasks) {
+                uBound = std::max(uBound, task.R.size() + task.vColors.back());
+            }
+        }
+        return uBound;
+    }
+
+    bool IsFinished() const
+    {
+        return m_iNumBusyWorkers.load() == 0 && m_iNumQueuedTasks.load() == 0;
+    }
+
+    std::atomic<size_t> m_uMaximumCliqueSize;
+    std::atomic<size_t> m_uNextRootBranch;
+
+    bool const          m_bWorkStealing;
+    int const           m_iNumWorkers;
+    std::atomic<int>    m_iNumBusyWorkers;
+    std::atomic<int>    m_iNumQueuedTasks;
+
+private:
+    class TaskQueue
+    {
+    public:
+        std::mutex m_Mutex;
+        std::deque<SearchTask> m_Tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> m_vTaskQueues;
+};
+
+#endif //PARALLEL_SEARCH_STATE_H
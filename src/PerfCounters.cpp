@@ -0,0 +1,178 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "PerfCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+#include <cstring>
+#include <cerrno>
+
+using namespace std;
+
+// The counters are opened as one group, so that a single read gets them all.
+PerfCounters::PerfCounters()
+: m_iError(0)
+, m_iLeader(-1)
+, m_iNumInGroup(0)
+{
+    for (int event = 0; event < NumEvents; ++event) {
+        m_Descriptors[event] = -1;
+        m_GroupOrder[event]  = -1;
+    }
+
+#ifdef __linux__
+    uint64_t const configs[NumEvents] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+    for (int event = 0; event < NumEvents; ++event) {
+        struct perf_event_attr attributes;
+        memset(&attributes, 0, sizeof(attributes));
+        attributes.size           = sizeof(attributes);
+        attributes.type           = PERF_TYPE_HARDWARE;
+        attributes.config         = configs[event];
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+        attributes.read_format    = PERF_FORMAT_GROUP;
+        m_Descriptors[event] = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0 /* this thread */, -1 /* any cpu */, m_iLeader, 0));
+        if (m_Descriptors[event] < 0) {
+            if (m_iError == 0) m_iError = errno;
+            continue;
+        }
+        if (m_iLeader < 0) m_iLeader = m_Descriptors[event];
+        m_GroupOrder[m_iNumInGroup++] = event;
+    }
+#endif // __linux__
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (int event = 0; event < NumEvents; ++event) {
+        if (m_Descriptors[event] >= 0) close(m_Descriptors[event]);
+    }
+#endif // __linux__
+}
+
+bool PerfCounters::Available() const
+{
+    for (int event = 0; event < NumEvents; ++event) {
+        if (m_Descriptors[event] >= 0) return true;
+    }
+    return false;
+}
+
+PerfCounters::Counts PerfCounters::Read() const
+{
+    Counts counts;
+#ifdef __linux__
+    if (m_iLeader < 0) return counts;
+
+    // the number of counters, then their values in the order they were opened.
+    uint64_t values[1 + NumEvents];
+    ssize_t const expectedSize(sizeof(uint64_t)*(1 + m_iNumInGroup));
+    if (read(m_iLeader, values, sizeof(values)) != expectedSize) return counts;
+    for (int index = 0; index < m_iNumInGroup; ++index) {
+        counts.value[m_GroupOrder[index]] = values[1 + index];
+    }
+#endif // __linux__
+    return counts;
+}
+
+char const *PerfCounters::Name(Event const event)
+{
+    switch (event) {
+        case Cycles:       return "cycles";
+        case Instructions: return "instructions";
+        case CacheMisses:  return "cache-misses";
+        case BranchMisses: return "branch-misses";
+        default:           return "unknown";
+    }
+}
+
+char const *PerfCounters::GetUnavailableReason() const
+{
+#ifdef __linux__
+    switch (m_iError) {
+        case 0:          return "";
+        case EACCES:
+        case EPERM:      return "not permitted, see /proc/sys/kernel/perf_event_paranoid";
+        case ENOENT:
+        case EOPNOTSUPP: return "the events are not supported here, as in many virtual machines and containers";
+        case ENOSYS:     return "the kernel has no perf_event_open";
+        default:         return strerror(m_iError);
+    }
+#else
+    return "only supported on Linux";
+#endif // __linux__
+}
+
+thread_local PerfProfile *PerfProfile::s_pActive(nullptr);
+
+PerfProfile::PerfProfile()
+: m_Counters()
+, m_Totals()
+, m_uCalls()
+, m_dSeconds()
+{
+}
+
+PerfProfile::~PerfProfile()
+{
+    if (s_pActive == this) s_pActive = nullptr;
+}
+
+void PerfProfile::Activate()
+{
+    s_pActive = this;
+}
+
+char const *PerfProfile::Name(Phase const phase)
+{
+    switch (phase) {
+        case InitialOrdering: return "initial ordering";
+        case Coloring:        return "coloring";
+        case Filtering:       return "filtering";
+        case Repair:          return "  repair";
+        default:              return "unknown";
+    }
+}
+
+void PerfProfile::Print(FILE *pFile) const
+{
+    bool const bCounters(m_Counters.Available());
+    if (!bCounters) {
+        fprintf(pFile, "Perf Counters      : not available (%s), only times are reported\n", m_Counters.GetUnavailableReason());
+    } else if (*m_Counters.GetUnavailableReason() != '\0') {
+        fprintf(pFile, "Perf Counters      : some events are not available (%s), and read as 0\n", m_Counters.GetUnavailableReason());
+    }
+
+    fprintf(pFile, "%-18s %12s %10s", "Phase", "calls", "seconds");
+    if (bCounters) fprintf(pFile, " %14s %14s %6s %13s %13s", "cycles", "instructions", "IPC", "cache-misses", "branch-misses");
+    fprintf(pFile, "\n");
+
+    for (int phase = 0; phase < NumPhases; ++phase) {
+        PerfCounters::Counts const &totals(m_Totals[phase]);
+        fprintf(pFile, "%-18s %12zu %10.4f", Name(static_cast<Phase>(phase)), m_uCalls[phase], m_dSeconds[phase]);
+        if (bCounters) {
+            uint64_t const cycles(totals.value[PerfCounters::Cycles]);
+            double const ipc(cycles > 0 ? static_cast<double>(totals.value[PerfCounters::Instructions])/cycles : 0.0);
+            fprintf(pFile, " %14llu %14llu %6.2f %13llu %13llu", static_cast<unsigned long long>(cycles), static_cast<unsigned long long>(totals.value[PerfCounters::Instructions]), ipc, static_cast<unsigned long long>(totals.value[PerfCounters::CacheMisses]), static_cast<unsigned long long>(totals.value[PerfCounters::BranchMisses]));
+        }
+        fprintf(pFile, "\n");
+    }
+}
@@ -0,0 +1,129 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+
+// Hardware counters of the calling thread, from Linux perf_event_open.
+// Counters that can't be opened (other systems, containers, or a restrictive
+// perf_event_paranoid) read as zero, see Available.
+class PerfCounters
+{
+public:
+    enum Event { Cycles = 0, Instructions, CacheMisses, BranchMisses, NumEvents };
+
+    struct Counts
+    {
+        Counts() : value() {}
+        uint64_t value[NumEvents];
+    };
+
+    PerfCounters();
+    ~PerfCounters();
+
+    bool Available() const;
+    bool Available(Event const event) const { return m_Descriptors[event] >= 0; }
+
+    // running totals since the counters were opened.
+    Counts Read() const;
+
+    static char const *Name(Event const event);
+
+    // why the counters that aren't available could not be opened.
+    char const *GetUnavailableReason() const;
+
+private:
+    PerfCounters(PerfCounters const &);
+    PerfCounters &operator=(PerfCounters const &);
+
+    int m_Descriptors[NumEvents];
+    int m_iError; // errno of the first counter that could not be opened
+    int m_iLeader;
+    int m_iNumInGroup;
+    int m_GroupOrder[NumEvents]; // events, in the order they joined the group
+};
+
+// Counts and times attributed to the phases of the search by PerfPhase
+// markers, on the thread that activated the profile. The phases are
+// inclusive, so the counts of Repair are also in Coloring.
+class PerfProfile
+{
+public:
+    enum Phase { InitialOrdering = 0, Coloring, Filtering, Repair, NumPhases };
+
+    PerfProfile();
+    ~PerfProfile();
+
+    // the markers on this thread count into this profile, until it is destroyed.
+    void Activate();
+    static PerfProfile *Active() { return s_pActive; }
+
+    PerfCounters const &GetCounters() const { return m_Counters; }
+
+    void Add(Phase const phase, PerfCounters::Counts const &start, PerfCounters::Counts const &end, double const seconds)
+    {
+        m_uCalls[phase]++;
+        m_dSeconds[phase] += seconds;
+        for (int event = 0; event < PerfCounters::NumEvents; ++event) {
+            m_Totals[phase].value[event] += end.value[event] - start.value[event];
+        }
+    }
+
+    void Print(FILE *pFile) const;
+
+    static char const *Name(Phase const phase);
+
+private:
+    static thread_local PerfProfile *s_pActive;
+
+    PerfCounters         m_Counters;
+    PerfCounters::Counts m_Totals[NumPhases];
+    size_t               m_uCalls[NumPhases];
+    double               m_dSeconds[NumPhases];
+};
+
+// Attributes the counts and time from construction to destruction to a
+// phase of pProfile, and does nothing if pProfile is null.
+class PerfPhase
+{
+public:
+    PerfPhase(PerfProfile *pProfile, PerfProfile::Phase const phase)
+    : m_pProfile(pProfile)
+    , m_Phase(phase)
+    {
+        if (m_pProfile == nullptr) return;
+        m_StartCounts = m_pProfile->GetCounters().Read();
+        m_StartTime   = std::chrono::steady_clock::now();
+    }
+
+    ~PerfPhase()
+    {
+        if (m_pProfile == nullptr) return;
+        double const seconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count());
+        m_pProfile->Add(m_Phase, m_StartCounts, m_pProfile->GetCounters().Read(), seconds);
+    }
+
+private:
+    PerfProfile *m_pProfile;
+    PerfProfile::Phase m_Phase;
+    PerfCounters::Counts m_StartCounts;
+    std::chrono::steady_clock::time_point m_StartTime;
+};
+
+#endif //PERF_COUNTERS_H
@@ -0,0 +1,140 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "SearchCheckpoint.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+SearchCheckpoint::SearchCheckpoint(string const &fileName, double const intervalInSeconds, string const &algorithmName, size_t const numVertices, size_t const numEntries)
+: m_sFileName(fileName)
+, m_dIntervalInSeconds(intervalInSeconds)
+, m_sAlgorithmName(algorithmName)
+, m_uNumVertices(numVertices)
+, m_uNumEntries(numEntries)
+, m_LastWrite(chrono::steady_clock::now())
+, m_vStateToWrite()
+, m_Writer()
+, m_bWriting(false)
+, m_uNumWritten(0)
+{
+    if (m_sAlgorithmName.size() >= sizeof(Header::algorithm)) {
+        m_sAlgorithmName.resize(sizeof(Header::algorithm) - 1);
+    }
+}
+
+SearchCheckpoint::~SearchCheckpoint()
+{
+    if (m_Writer.joinable()) m_Writer.join();
+}
+
+bool SearchCheckpoint::Due() const
+{
+    return !m_bWriting.load(memory_order_relaxed) &&
+           chrono::duration<double>(chrono::steady_clock::now() - m_LastWrite).count() >= m_dIntervalInSeconds;
+}
+
+void SearchCheckpoint::Write(vector<int64_t> &vState, bool const bWait)
+{
+    if (m_Writer.joinable()) m_Writer.join();
+
+    m_vStateToWrite.swap(vState);
+    m_LastWrite = chrono::steady_clock::now();
+    m_uNumWritten++;
+
+    if (bWait) {
+        WriteFile(m_vStateToWrite);
+        return;
+    }
+
+    m_bWriting = true;
+    m_Writer = thread([this]() {
+        WriteFile(m_vStateToWrite);
+        m_bWriting = false;
+    });
+}
+
+SearchCheckpoint::Header SearchCheckpoint::MakeHeader(size_t const stateSize) const
+{
+    Header header;
+    memset(&header, 0, sizeof(Header));
+    memcpy(header.magic, Magic(), sizeof(header.magic));
+    header.numVertices = m_uNumVertices;
+    header.numEntries  = m_uNumEntries;
+    memcpy(header.algorithm, m_sAlgorithmName.c_str(), m_sAlgorithmName.size());
+    header.stateSize   = stateSize;
+    return header;
+}
+
+void SearchCheckpoint::WriteFile(vector<int64_t> const &vState) const
+{
+    string const temporaryFileName(m_sFileName + ".tmp");
+    FILE *pFile(fopen(temporaryFileName.c_str(), "wb"));
+    if (pFile == nullptr) {
+        fprintf(stderr, "ERROR: Unable to open file %s for writing\n", temporaryFileName.c_str());
+        exit(1);
+    }
+
+    Header const header(MakeHeader(vState.size()));
+    bool bWritten(fwrite(&header, sizeof(Header), 1, pFile) == 1);
+    bWritten = bWritten && fwrite(vState.data(), sizeof(int64_t), vState.size(), pFile) == vState.size();
+
+    if (fclose(pFile) != 0 || !bWritten || rename(temporaryFileName.c_str(), m_sFileName.c_str()) != 0) {
+        fprintf(stderr, "ERROR: Problem writing checkpoint %s\n", m_sFileName.c_str());
+        exit(1);
+    }
+}
+
+bool SearchCheckpoint::Read(string const &fileName, vector<int64_t> &vState) const
+{
+    FILE *pFile(fopen(fileName.c_str(), "rb"));
+    if (pFile == nullptr) return false;
+
+    Header header;
+    Header const expected(MakeHeader(0));
+    if (fread(&header, sizeof(Header), 1, pFile) != 1 || memcmp(header.magic, Magic(), sizeof(header.magic)) != 0) {
+        fprintf(stderr, "ERROR: File %s is not a checkpoint\n", fileName.c_str());
+        exit(1);
+    }
+
+    if (header.numVertices != expected.numVertices || header.numEntries != expected.numEntries ||
+        memcmp(header.algorithm, expected.algorithm, sizeof(header.algorithm)) != 0) {
+        fprintf(stderr, "ERROR: Checkpoint %s is for %s on a graph with %llu vertices, not %s on this graph\n", fileName.c_str(), string(header.algorithm, strnlen(header.algorithm, sizeof(header.algorithm))).c_str(), static_cast<unsigned long long>(header.numVertices), m_sAlgorithmName.c_str());
+        exit(1);
+    }
+
+    // the state size comes from the file, so check it against the file's size
+    // before allocating for it.
+    long const stateStart(ftell(pFile));
+    bool bRead(stateStart >= 0 && fseek(pFile, 0, SEEK_END) == 0);
+    long const fileSize(bRead ? ftell(pFile) : -1);
+    bRead = bRead && fileSize >= stateStart && header.stateSize <= static_cast<uint64_t>(fileSize - stateStart) / sizeof(int64_t);
+    bRead = bRead && fseek(pFile, stateStart, SEEK_SET) == 0;
+
+    if (bRead) {
+        vState.resize(header.stateSize);
+        bRead = fread(vState.data(), sizeof(int64_t), vState.size(), pFile) == vState.size();
+    }
+    fclose(pFile);
+
+    if (!bRead) {
+        fprintf(stderr, "ERROR: Checkpoint %s is truncated\n", fileName.c_str());
+        exit(1);
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef SEARCH_CHECKPOINT_H
+#define SEARCH_CHECKPOINT_H
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Periodically saves the state of a search to a file, so that a stopped run
+// can be resumed from where it was. The search copies its state into a
+// buffer, and a background thread writes it to <file>.tmp and renames it over
+// <file>, so that the file always holds a complete checkpoint.
+//
+// The header records the algorithm and the size of the graph, and Read
+// refuses checkpoints that do not match them.
+class SearchCheckpoint
+{
+public:
+    SearchCheckpoint(std::string const &fileName, double const intervalInSeconds, std::string const &algorithmName, size_t const numVertices, size_t const numEntries);
+    ~SearchCheckpoint();
+
+    // true if the interval has passed, and the last checkpoint is written.
+    bool Due() const;
+
+    // takes the buffer, and writes it in the background, or right away if bWait.
+    void Write(std::vector<int64_t> &vState, bool const bWait);
+
+    // returns false if there is no such file.
+    bool Read(std::string const &fileName, std::vector<int64_t> &vState) const;
+
+    size_t GetNumWritten() const { return m_uNumWritten; }
+    size_t GetNumVertices() const { return m_uNumVertices; }
+
+    static char const *Magic() { return "OMCSCKP1"; }
+
+    struct Header
+    {
+        char     magic[8];
+        uint64_t numVertices;
+        uint64_t numEntries;
+        char     algorithm[32];
+        uint64_t stateSize; // number of int64_t's after the header
+    };
+
+protected:
+    void WriteFile(std::vector<int64_t> const &vState) const;
+    Header MakeHeader(size_t const stateSize) const;
+
+    std::string m_sFileName;
+    double      m_dIntervalInSeconds;
+    std::string m_sAlgorithmName;
+    size_t      m_uNumVertices;
+    size_t      m_uNumEntries;
+    std::chrono::steady_clock::time_point m_LastWrite;
+    std::vector<int64_t> m_vStateToWrite;
+    std::thread m_Writer;
+    std::atomic<bool> m_bWriting;
+    size_t      m_uNumWritten;
+};
+
+#endif //SEARCH_CHECKPOINT_H
@@ -0,0 +1,96 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef SEARCH_LIMITS_H
+#define SEARCH_LIMITS_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstddef>
+#include <algorithm>
+
+// Wall-clock and search node budgets for one run, shared by every thread and
+// subproblem solver working on it. A limit of 0 means no limit. Searches
+// count their nodes here every few nodes, and stop as soon as Check reports
+// that a limit was reached, keeping the largest clique found so far.
+class SearchLimits
+{
+public:
+    SearchLimits(double const timeLimitInSeconds, size_t const nodeLimit)
+    : m_Start(std::chrono::steady_clock::now())
+    , m_dTimeLimitInSeconds(timeLimitInSeconds)
+    , m_uNodeLimit(nodeLimit)
+    , m_uNodeCount(0)
+    , m_iStopReason(NOT_STOPPED)
+    {
+    }
+
+    // the time limit counts from here.
+    void Start() { m_Start = std::chrono::steady_clock::now(); }
+
+    void AddNodes(size_t const uNewNodes) { m_uNodeCount.fetch_add(uNewNodes, std::memory_order_relaxed); }
+
+    // adds the nodes searched since the last check, returns true if the
+    // search must stop.
+    bool Check(size_t const uNewNodes)
+    {
+        size_t const uNodeCount(m_uNodeCount.fetch_add(uNewNodes, std::memory_order_relaxed) + uNewNodes);
+        if (m_uNodeLimit > 0 && uNodeCount >= m_uNodeLimit) {
+            Stop(NODE_LIMIT);
+        } else if (m_dTimeLimitInSeconds > 0.0 &&
+                   std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count() >= m_dTimeLimitInSeconds) {
+            Stop(TIMED_OUT);
+        }
+        return Stopped();
+    }
+
+    // checks are cheap, but not free: check every 64 nodes, or sooner if the
+    // node limit is closer than that.
+    size_t NodesUntilNextCheck() const
+    {
+        if (m_uNodeLimit == 0) return 64;
+        size_t const uNodeCount(m_uNodeCount.load(std::memory_order_relaxed));
+        return (uNodeCount >= m_uNodeLimit) ? 1 : std::min(static_cast<size_t>(64), m_uNodeLimit - uNodeCount);
+    }
+
+    bool Stopped() const { return m_iStopReason.load(std::memory_order_relaxed) != NOT_STOPPED; }
+
+    std::string GetStatus() const
+    {
+        switch (m_iStopReason.load()) {
+            case TIMED_OUT:  return "timed-out";
+            case NODE_LIMIT: return "node-limit";
+            default:         return "optimal";
+        }
+    }
+
+private:
+    enum StopReason { NOT_STOPPED, TIMED_OUT, NODE_LIMIT };
+
+    void Stop(int const reason)
+    {
+        int expected(NOT_STOPPED);
+        m_iStopReason.compare_exchange_strong(expected, reason);
+    }
+
+    std::chrono::steady_clock::time_point m_Start;
+    double const        m_dTimeLimitInSeconds;
+    size_t const        m_uNodeLimit;
+    std::atomic<size_t> m_uNodeCount;
+    std::atomic<int>    m_iStopReason;
+};
+
+#endif //SEARCH_LIMITS_H
@@ -0,0 +1,82 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "SearchStatistics.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+
+static void Add(SearchStatistics::Depth &sum, SearchStatistics::Depth const &depth)
+{
+    sum.nodes           += depth.nodes;
+    sum.candidates      += depth.candidates;
+    sum.boundPrunes     += depth.boundPrunes;
+    sum.prunedBranches  += depth.prunedBranches;
+    sum.repairAttempts  += depth.repairAttempts;
+    sum.repairSuccesses += depth.repairSuccesses;
+    sum.colorSeconds    += depth.colorSeconds;
+    sum.newOrderSeconds += depth.newOrderSeconds;
+}
+
+static void WriteDepth(FILE *pFile, SearchStatistics::Depth const &depth)
+{
+    fprintf(pFile, "\"nodes\": %zu, \"average_candidates\": %.3f, \"bound_prunes\": %zu, \"pruned_branches\": %zu, \"repair_attempts\": %zu, \"repair_successes\": %zu, \"color_seconds\": %.6f, \"new_order_seconds\": %.6f",
+            depth.nodes, depth.nodes == 0 ? 0.0 : static_cast<double>(depth.candidates)/depth.nodes,
+            depth.boundPrunes, depth.prunedBranches, depth.repairAttempts, depth.repairSuccesses,
+            depth.colorSeconds, depth.newOrderSeconds);
+}
+
+void SearchStatistics::Merge(SearchStatistics const &other)
+{
+    for (size_t index = 0; index < other.m_vDepths.size(); ++index) {
+        Add(AtDepth(index), other.m_vDepths[index]);
+    }
+}
+
+SearchStatistics::Depth SearchStatistics::Total() const
+{
+    Depth total;
+    for (Depth const &depth : m_vDepths) {
+        Add(total, depth);
+    }
+    return total;
+}
+
+void SearchStatistics::WriteJson(string const &fileName, string const &algorithmName) const
+{
+    FILE *pFile(fopen(fileName.c_str(), "w"));
+    if (pFile == nullptr) {
+        fprintf(stderr, "ERROR: Unable to open file %s for writing\n", fileName.c_str());
+        exit(1);
+    }
+
+    fprintf(pFile, "{\n  \"algorithm\": \"%s\",\n  \"total\": { ", algorithmName.c_str());
+    WriteDepth(pFile, Total());
+    fprintf(pFile, " },\n  \"depths\": [");
+
+    for (size_t index = 0; index < m_vDepths.size(); ++index) {
+        fprintf(pFile, "%s\n    { \"depth\": %zu, ", index == 0 ? "" : ",", index);
+        WriteDepth(pFile, m_vDepths[index]);
+        fprintf(pFile, " }");
+    }
+
+    fprintf(pFile, "\n  ]\n}\n");
+    if (fclose(pFile) != 0) {
+        fprintf(stderr, "ERROR: Problem writing file %s\n", fileName.c_str());
+        exit(1);
+    }
+}
@@ -0,0 +1,60 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef SEARCH_STATISTICS_H
+#define SEARCH_STATISTICS_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+// Counters for the search tree, by depth of the search node. They are only
+// collected by the instantiation of the search that is compiled with
+// statistics, see MaxSubgraphAlgorithm::RunSearch.
+class SearchStatistics
+{
+public:
+    struct Depth
+    {
+        Depth() : nodes(0), candidates(0), boundPrunes(0), prunedBranches(0), repairAttempts(0), repairSuccesses(0), colorSeconds(0.0), newOrderSeconds(0.0) {}
+
+        size_t nodes;
+        size_t candidates;      // sum of |P| over the nodes
+        size_t boundPrunes;     // nodes cut off by the color bound
+        size_t prunedBranches;  // branches left in P when they were cut off
+        size_t repairAttempts;  // Repair calls while coloring the children
+        size_t repairSuccesses;
+        double colorSeconds;    // coloring the children
+        double newOrderSeconds; // computing the children's candidates
+    };
+
+    SearchStatistics() : m_vDepths() {}
+
+    Depth &AtDepth(size_t const depth)
+    {
+        if (m_vDepths.size() <= depth) m_vDepths.resize(depth + 1);
+        return m_vDepths[depth];
+    }
+
+    void Merge(SearchStatistics const &other);
+    Depth Total() const;
+
+    void WriteJson(std::string const &fileName, std::string const &algorithmName) const;
+
+private:
+    std::vector<Depth> m_vDepths;
+};
+
+#endif //SEARCH_STATISTICS_H
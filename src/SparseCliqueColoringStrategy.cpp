@@ -14,6 +14,7 @@
 */
 
 #include "SparseCliqueColoringStrategy.h"
+#include "PerfCounters.h"
 #include "DegeneracyTools.h"
 
 #include <cmath>
@@ -156,23 +157,17 @@ void SparseCliqueColoringStrategy::Recolor(vector<vector<int>> const &adjacencyA
         int uSmallestFreeColor = maxColor + 1;
         // first count the number of neighbors with a given color
         for (int const neighbor : m_AdjacencyArray[vertex]) {
-            m_vbNeighbors[neighbor] = true;
             if (m_vVertexToColor[neighbor] != -1) {
                 m_vNeighborColorCount[m_vVertexToColor[neighbor]]++;
             }
         }
 
-        // compare color counts to total number of vertices with the color
-        // if there is a difference, then there exists a non-neighbor with
-        // that color; otherwise the color is free. Pick the smallest such
-        // free color
-        for (int const neighbor : m_AdjacencyArray[vertex]) {
-            int const currentColor(m_vVertexToColor[neighbor]);
-////            if (debug && neighbor==28) {
-////                cout << " neighbor 28 has color " << currentColor << ", there are " << m_vvVerticesWithColor[currentColor].size() << " vertices with that color, and " << m_vNeighborColorCount[currentColor] << " neighbors with that color" << endl;
-////            }
-            if (currentColor != -1 && static_cast<int>(m_vvVerticesWithColor[currentColor].size()) == m_vNeighborColorCount[currentColor]) {
-                uSmallestFreeColor = min(currentColor, static_cast<int>(uSmallestFreeColor));
+        // a color is free if no neighbor has it; pick the smallest such
+        // free color.
+        for (int color = 0; color <= maxColor; ++color) {
+            if (m_vNeighborColorCount[color] == 0) {
+                uSmallestFreeColor = color;
+                break;
             }
         }
 
@@ -207,17 +202,33 @@ void SparseCliqueColoringStrategy::Recolor(vector<vector<int>> const &adjacencyA
         m_vvVerticesWithColor[uSmallestFreeColor].push_back(vertex);
         m_vVertexToColor[vertex] = uSmallestFreeColor;
         maxColor = max(maxColor, uSmallestFreeColor);
+
+        // put color counts back to 0, by color or by neighbor, whichever is
+        // fewer. Needs to come before repair, which recolors a neighbor.
+        if (static_cast<int>(m_AdjacencyArray[vertex].size()) > maxColor) {
+            for (int color = 0; color <= maxColor; ++color) {
+                m_vNeighborColorCount[color] = 0;
+            }
+        } else {
+            for (int const neighbor : m_AdjacencyArray[vertex]) {
+                if (m_vVertexToColor[neighbor] != -1) {
+                    m_vNeighborColorCount[m_vVertexToColor[neighbor]] = 0;
+                }
+            }
+        }
+
+        // only repair needs the neighbors marked.
         if (uSmallestFreeColor +1 > iBestCliqueDelta && /*m_vvVerticesWithColor[color].size() == 1*/ uSmallestFreeColor == maxColor) {
+            for (int const neighbor : m_AdjacencyArray[vertex]) {
+                m_vbNeighbors[neighbor] = true;
+            }
+
             Repair(vertex, uSmallestFreeColor, iBestCliqueDelta);
             if (m_vvVerticesWithColor[maxColor].empty())
                 maxColor--;
-        }
 
-        // put color counts back to 0. Needs to come after repair, repair uses the counts.
-        for (int const neighbor : m_AdjacencyArray[vertex]) {
-            m_vbNeighbors[neighbor] = false;
-            if (m_vVertexToColor[neighbor] != -1) {
-                m_vNeighborColorCount[m_vVertexToColor[neighbor]] = 0;
+            for (int const neighbor : m_AdjacencyArray[vertex]) {
+                m_vbNeighbors[neighbor] = false;
             }
         }
     }
@@ -291,6 +302,8 @@ int SparseCliqueColoringStrategy::GetConflictingVertex(int const vertex, vector<
 
 bool SparseCliqueColoringStrategy::Repair(int const vertex, int const color, int const iBestCliqueDelta)
 {
+    m_uRepairAttempts++;
+    PerfPhase const phase(PerfProfile::Active(), PerfProfile::Repair);
     for (int newColor = 0; newColor <= iBestCliqueDelta-1; newColor++) {
         int const conflictingVertex(GetConflictingVertex(vertex, m_vvVerticesWithColor[newColor]));
         if (conflictingVertex < 0) continue;
@@ -314,6 +327,7 @@ bool SparseCliqueColoringStrategy::Repair(int const vertex, int const color, int
             for (int const neighbor : m_AdjacencyArray[conflictingVertex]) {
                 m_vbConflictNeighbors[neighbor] = false;
             }
+            m_uRepairSuccesses++;
             return true;
         }
 
@@ -14,6 +14,7 @@
 */
 
 #include "SparseIndependentSetColoringStrategy.h"
+#include "PerfCounters.h"
 #include "DegeneracyTools.h"
 
 #include <cmath>
@@ -188,67 +189,75 @@ void SparseIndependentSetColoringStrategy::Recolor(vector<vector<int>> const &ad
 ////        cout << endl;
 ////        }
 
-#if 1
+        vector<int> const &neighbors(m_AdjacencyArray[vertex]);
+        // a high degree vertex in a small order: search its (sorted) neighbors
+        // for the members of each color class instead of counting them.
+        bool const bSearchNeighbors(neighbors.size() > vVertexOrder.size());
         int uSmallestFreeColor = maxColor + 1;
-        // first count the number of neighbors with a given color
-        for (int const neighbor : m_AdjacencyArray[vertex]) {
-            m_vbNeighbors[neighbor] = true;
-            if (m_vVertexToColor[neighbor] != -1) {
-                m_vNeighborColorCount[m_vVertexToColor[neighbor]]++;
+        if (bSearchNeighbors) {
+            for (int color = 0; color <= maxColor; ++color) {
+                bool bFree(true);
+                for (int const coloredVertex : m_vvVerticesWithColor[color]) {
+                    if (!binary_search(neighbors.begin(), neighbors.end(), coloredVertex)) {
+                        bFree = false;
+                        break;
+                    }
+                }
+                if (bFree) {
+                    uSmallestFreeColor = color;
+                    break;
+                }
             }
-        }
-
-        // compare color counts to total number of vertices with the color
-        // if there is a difference, then there exists a non-neighbor with
-        // that color; otherwise the color is free. Pick the smallest such
-        // free color
-        for (int const neighbor : m_AdjacencyArray[vertex]) {
-            int const currentColor(m_vVertexToColor[neighbor]);
-////            if (debug && neighbor==28) {
-////                cout << " neighbor 28 has color " << currentColor << ", there are " << m_vvVerticesWithColor[currentColor].size() << " vertices with that color, and " << m_vNeighborColorCount[currentColor] << " neighbors with that color" << endl;
-////            }
-            if (currentColor != -1 && static_cast<int>(m_vvVerticesWithColor[currentColor].size()) == m_vNeighborColorCount[currentColor]) {
-                uSmallestFreeColor = min(currentColor, static_cast<int>(uSmallestFreeColor));
+        } else {
+            // first count the number of neighbors with a given color
+            for (int const neighbor : m_AdjacencyArray[vertex]) {
+                m_vbNeighbors[neighbor] = true;
+                if (m_vVertexToColor[neighbor] != -1) {
+                    m_vNeighborColorCount[m_vVertexToColor[neighbor]]++;
+                }
             }
-        }
-
-////        // put color counts back to 0.
-////        for (int const neighbor : m_AdjacencyArray[vertex]) {
-////            if (m_vVertexToColor[neighbor] != -1) {
-////                m_vNeighborColorCount[m_vVertexToColor[neighbor]] = 0;
-////            }
-////        }
 
-#else
-        int uSmallestFreeColor = 0;
-        for (vector<int> const &verticesWithColor : m_vvVerticesWithColor) {
-            bool hasNeighborWithColor(false);
-            if (verticesWithColor.empty()) break;
-            for (int const coloredVertex : verticesWithColor) {
-                // can be made more efficient?
-                hasNeighborWithColor = (find(adjacencyArray[vertex].begin(), adjacencyArray[vertex].end(), coloredVertex) == adjacencyArray[vertex].end());
-                if (hasNeighborWithColor) {
-                    uSmallestFreeColor++;
-                    break;
+            // compare color counts to total number of vertices with the color
+            // if there is a difference, then there exists a non-neighbor with
+            // that color; otherwise the color is free. Pick the smallest such
+            // free color
+            for (int const neighbor : m_AdjacencyArray[vertex]) {
+                int const currentColor(m_vVertexToColor[neighbor]);
+////                if (debug && neighbor==28) {
+////                    cout << " neighbor 28 has color " << currentColor << ", there are " << m_vvVerticesWithColor[currentColor].size() << " vertices with that color, and " << m_vNeighborColorCount[currentColor] << " neighbors with that color" << endl;
+////                }
+                if (currentColor != -1 && static_cast<int>(m_vvVerticesWithColor[currentColor].size()) == m_vNeighborColorCount[currentColor]) {
+                    uSmallestFreeColor = min(currentColor, static_cast<int>(uSmallestFreeColor));
                 }
             }
 
-            if (!hasNeighborWithColor) {
-                break;
-            }
+////            // put color counts back to 0.
+////            for (int const neighbor : m_AdjacencyArray[vertex]) {
+////                if (m_vVertexToColor[neighbor] != -1) {
+////                    m_vNeighborColorCount[m_vVertexToColor[neighbor]] = 0;
+////                }
+////            }
         }
-#endif // 1
 ////        cout << "vertex " << vertex << " gets initial color " << uSmallestFreeColor << endl;
 
         m_vvVerticesWithColor[uSmallestFreeColor].push_back(vertex);
         m_vVertexToColor[vertex] = uSmallestFreeColor;
         maxColor = max(maxColor, uSmallestFreeColor);
         if (uSmallestFreeColor +1 > iBestCliqueDelta && /*m_vvVerticesWithColor[color].size() == 1*/ uSmallestFreeColor == maxColor) {
+            // repair looks up the neighbors of vertex by their marks.
+            if (bSearchNeighbors) {
+                for (int const neighbor : neighbors) m_vbNeighbors[neighbor] = true;
+            }
             Repair(vertex, uSmallestFreeColor, iBestCliqueDelta);
             if (m_vvVerticesWithColor[maxColor].empty())
                 maxColor--;
+            if (bSearchNeighbors) {
+                for (int const neighbor : neighbors) m_vbNeighbors[neighbor] = false;
+            }
         }
 
+        if (bSearchNeighbors) continue;
+
         // put color counts back to 0. Needs to come after repair, repair uses the counts.
         for (int const neighbor : m_AdjacencyArray[vertex]) {
             m_vbNeighbors[neighbor] = false;
@@ -327,6 +336,8 @@ int SparseIndependentSetColoringStrategy::GetConflictingVertex(int const vertex,
 
 bool SparseIndependentSetColoringStrategy::Repair(int const vertex, int const color, int const iBestCliqueDelta)
 {
+    m_uRepairAttempts++;
+    PerfPhase const phase(PerfProfile::Active(), PerfProfile::Repair);
     for (int newColor = 0; newColor <= iBestCliqueDelta-1; newColor++) {
         int const conflictingVertex(GetConflictingVertex(vertex, m_vvVerticesWithColor[newColor]));
         if (conflictingVertex < 0) continue;
@@ -350,6 +361,7 @@ bool SparseIndependentSetColoringStrategy::Repair(int const vertex, int const co
             for (int const neighbor : m_AdjacencyArray[conflictingVertex]) {
                 m_vbConflictNeighbors[neighbor] = false;
             }
+            m_uRepairSuccesses++;
             return true;
         }
 
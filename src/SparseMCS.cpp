@@ -0,0 +1,96 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "SparseMCS.h"
+#include "OrderingTools.h"
+#include "CandidateFilters.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+SparseMCS::SparseMCS(vector<vector<int>> const &adjacencyArray)
+: MaxSubgraphAlgorithm("sparse-mcs")
+, m_AdjacencyArray(adjacencyArray)
+, coloringStrategy(adjacencyArray)
+, m_vRank(adjacencyArray.size(), -1)
+, m_vbNeighbor(adjacencyArray.size(), 0)
+{
+    size_t maxDegree(0);
+    for (vector<int> const &neighbors : adjacencyArray) {
+        maxDegree = max(maxDegree, neighbors.size());
+    }
+
+    // a clique has at most maxDegree+1 vertices.
+    R.reserve(maxDegree + 1);
+}
+
+void SparseMCS::InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors)
+{
+    OrderingTools::InitialOrderingMCR(m_AdjacencyArray, P, vColors, m_uMaximumCliqueSize);
+    vVertexOrder = P;
+}
+
+void SparseMCS::AdoptInitialOrder(std::vector<int> const &vVertexOrder)
+{
+    for (size_t rank = 0; rank < vVertexOrder.size(); ++rank) {
+        m_vRank[vVertexOrder[rank]] = rank;
+    }
+}
+
+void SparseMCS::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
+{
+    coloringStrategy.Recolor(m_AdjacencyArray, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()));
+}
+
+void SparseMCS::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVertexOrder, vector<int> const &P, int const chosenVertex)
+{
+    vector<int> const &neighbors(m_AdjacencyArray[chosenVertex]);
+    vNewVertexOrder.clear();
+
+    if (depth == 0) {
+        // root branches are taken in reverse static order, so the candidates
+        // left are exactly the neighbors ranked before the chosen vertex.
+        int const chosenRank(m_vRank[chosenVertex]);
+        for (int const neighbor : neighbors) {
+            if (m_vRank[neighbor] < chosenRank) vNewVertexOrder.push_back(neighbor);
+        }
+        sort(vNewVertexOrder.begin(), vNewVertexOrder.end(), [this](int const first, int const second) { return m_vRank[first] < m_vRank[second]; });
+    } else if (neighbors.size() > 8*vVertexOrder.size()) {
+        // a high degree vertex in a small candidate set, search its (sorted) neighbors.
+        CandidateFilters::SearchedNeighbors(m_AdjacencyArray, vVertexOrder, chosenVertex, vNewVertexOrder);
+    } else {
+        CandidateFilters::MarkedNeighbors(m_AdjacencyArray, m_vbNeighbor, vVertexOrder, chosenVertex, vNewVertexOrder);
+    }
+
+    R.push_back(chosenVertex);
+}
+
+void SparseMCS::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex)
+{
+    if (chosenVertex == -1) return;
+
+    // the root order is never filtered, see GetNewOrder.
+    if (depth > 0) {
+        vVertexOrder.erase(find(vVertexOrder.begin(), vVertexOrder.end(), chosenVertex));
+    }
+    R.pop_back();
+}
+
+void SparseMCS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<SparseMCS>(P, vVertexOrder, cliques, vColors);
+}
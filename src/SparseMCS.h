@@ -0,0 +1,53 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#ifndef SPARSE_MCS_H
+#define SPARSE_MCS_H
+
+#include "MaxSubgraphAlgorithm.h"
+#include "SparseCliqueColoringStrategy.h"
+
+#include <vector>
+#include <list>
+
+// MCS on adjacency arrays, for graphs too large for an adjacency matrix:
+// memory is O(n+m), and the search stacks are bounded by the maximum degree.
+// Candidates at the root are the earlier neighbors in the static order, so
+// that no root branch touches more than its own neighborhood.
+class SparseMCS : public MaxSubgraphAlgorithm
+{
+public:
+    SparseMCS(std::vector<std::vector<int>> const &adjacencyArray);
+
+    virtual void Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors);
+
+    virtual void InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors);
+    virtual void AdoptInitialOrder(std::vector<int> const &vVertexOrder);
+    virtual void GetNewOrder(std::vector<int> &vNewVertexOrder, std::vector<int> &vVertexOrder, std::vector<int> const &P, int const chosenVertex);
+    virtual void ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex);
+    virtual void ProcessOrderBeforeReturn(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors) {}
+
+    virtual void RunRecursive(std::vector<int> &P, std::vector<int> &vVertexOrder, std::list<std::list<int>> &cliques, std::vector<int> &vColors);
+
+    virtual ColoringStrategy const *GetColoringStrategy() const { return &coloringStrategy; }
+
+protected:
+    std::vector<std::vector<int>> const &m_AdjacencyArray;
+    SparseCliqueColoringStrategy coloringStrategy;
+    std::vector<int>  m_vRank;       // vertex -> position in the initial ordering
+    std::vector<char> m_vbNeighbor;  // scratch, marks the chosen vertex's neighbors
+};
+
+#endif //SPARSE_MCS_H
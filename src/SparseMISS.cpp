@@ -0,0 +1,68 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+#include "SparseMISS.h"
+#include "OrderingTools.h"
+#include "CandidateFilters.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+SparseMISS::SparseMISS(vector<vector<int>> const &adjacencyArray)
+: MaxSubgraphAlgorithm("sparse-miss")
+, m_AdjacencyArray(adjacencyArray)
+, coloringStrategy(adjacencyArray)
+, m_vbNeighbor(adjacencyArray.size(), 0)
+{
+    R.reserve(adjacencyArray.size());
+}
+
+void SparseMISS::InitializeOrder(std::vector<int> &P, std::vector<int> &vVertexOrder, std::vector<int> &vColors)
+{
+    OrderingTools::InitialOrderingMISR(m_AdjacencyArray, P, vColors, m_uMaximumCliqueSize);
+    vVertexOrder = P;
+}
+
+void SparseMISS::Color(std::vector<int> const &vVertexOrder, std::vector<int> &vVerticesToReorder, std::vector<int> &vColors)
+{
+    coloringStrategy.Recolor(m_AdjacencyArray, vVertexOrder/* evaluation order */, vVerticesToReorder /* color order */, vColors, static_cast<int>(m_uMaximumCliqueSize), static_cast<int>(R.size()));
+}
+
+void SparseMISS::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVertexOrder, vector<int> const &P, int const chosenVertex)
+{
+    if (m_AdjacencyArray[chosenVertex].size() > 8*vVertexOrder.size()) {
+        CandidateFilters::SearchedNonNeighbors(m_AdjacencyArray, vVertexOrder, chosenVertex, vNewVertexOrder);
+    } else {
+        CandidateFilters::MarkedNonNeighbors(m_AdjacencyArray, m_vbNeighbor, vVertexOrder, chosenVertex, vNewVertexOrder);
+    }
+
+    R.push_back(chosenVertex);
+}
+
+void SparseMISS::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder, std::vector<int> &P, std::vector<int> &vColors, int const chosenVertex)
+{
+    if (chosenVertex == -1) return;
+
+    // chosen vertices are near the end of the order.
+    vVertexOrder.erase(find(vVertexOrder.rbegin(), vVertexOrder.rend(), chosenVertex).base() - 1);
+    R.pop_back();
+}
+
+void SparseMISS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<SparseMISS>(P, vVertexOrder, cliques, vColors);
+}
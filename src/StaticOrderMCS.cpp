@@ -15,6 +15,7 @@
 
 #include "StaticOrderMCS.h"
 #include "OrderingTools.h"
+#include "CandidateFilters.h"
 
 #include <cmath>
 #include <algorithm>
@@ -36,14 +37,7 @@ void StaticOrderMCS::InitializeOrder(std::vector<int> &P, std::vector<int> &vVer
 
 void StaticOrderMCS::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVertexOrder, vector<int> const &P, int const chosenVertex)
 {
-    vNewVertexOrder.resize(P.size());
-    {
-        size_t uNewIndex(0);
-        for (int const candidate : vVertexOrder) {
-            if (m_AdjacencyMatrix[chosenVertex][candidate]) vNewVertexOrder[uNewIndex++] = candidate;
-        }
-        vNewVertexOrder.resize(uNewIndex);
-    }
+    CandidateFilters::Neighbors(m_AdjacencyMatrix, vVertexOrder, chosenVertex, vNewVertexOrder);
 
     R.push_back(chosenVertex);
 }
@@ -69,3 +63,8 @@ void StaticOrderMCS::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder,
 #endif // 0
     R.pop_back();
 }
+
+void StaticOrderMCS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<StaticOrderMCS>(P, vVertexOrder, cliques, vColors);
+}
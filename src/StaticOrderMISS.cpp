@@ -15,6 +15,7 @@
 
 #include "StaticOrderMISS.h"
 #include "OrderingTools.h"
+#include "CandidateFilters.h"
 #include "GraphTools.h"
 
 #include <cmath>
@@ -42,19 +43,7 @@ void StaticOrderMISS::GetNewOrder(vector<int> &vNewVertexOrder, vector<int> &vVe
 ////        cout << vertex << " ";
 ////    }
 ////    cout << endl;
-    vNewVertexOrder.resize(vVertexOrder.size());
-    {
-        size_t uNewIndex(0);
-        for (int const candidate : vVertexOrder) {
-////            cout << depth << ": accessing " << chosenVertex << "," << candidate << " in " << m_AdjacencyMatrix.size() << "," << m_AdjacencyMatrix[chosenVertex].size() << endl << flush;
-////            cout << depth << ": put in index " << uNewIndex << "/" << vNewVertexOrder.size() << endl << flush;
-////            cout << depth << ": size of stackP : " << stackP.size() << endl;
-////            cout << depth << ": size of stackOrder: " << stackOrder.size() << endl;
-            if (chosenVertex == candidate) continue;
-            if (!m_AdjacencyMatrix[chosenVertex][candidate]) vNewVertexOrder[uNewIndex++] = candidate;
-        }
-        vNewVertexOrder.resize(uNewIndex);
-    }
+    CandidateFilters::NonNeighbors(m_AdjacencyMatrix, vVertexOrder, chosenVertex, vNewVertexOrder);
 
     R.push_back(chosenVertex);
 
@@ -96,3 +85,8 @@ void StaticOrderMISS::ProcessOrderAfterRecursion(std::vector<int> &vVertexOrder,
     vVertexOrder.pop_back();
     R.pop_back();
 }
+
+void StaticOrderMISS::RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+{
+    RunRecursiveStatic<StaticOrderMISS>(P, vVertexOrder, cliques, vColors);
+}
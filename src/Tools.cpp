@@ -16,6 +16,7 @@
 #include <cassert>
 #include <cstdio>
 #include <ctime>
+#include <chrono>
 #include <fstream> // ifstream
 //#include <csys/resource.h>
 
@@ -28,6 +29,7 @@
 #include <sstream>
 #include "MemoryManager.h"
 #include "Algorithm.h"
+#include "SearchLimits.h"
 
 using namespace std;
 
@@ -374,58 +376,6 @@ vector<list<int>> readInGraphAdjList(int &n, int &m, string const &fileName)
     return adjList;
 }
 
-#if 0
-vector<list<int>> readInGraphAdjListDimacs(int &n, int &m, string const &fileName)
-{
-
-    std::getline(instream, line);
-    ifstream instream(fileName.c_str());
-
-    if (instream.good() && !instream.eof())
-        instream >> m;
-    else {
-
-        fprintf(stderr, "problem with line 2 in input file\n");
-        exit(1);
-    }
-
-#ifdef DEBUG
-    printf("Number of vertices: %d\n", n);
-    printf("Number of edges: %d\n", m);
-#endif
-    
-    vector<list<int>> adjList(n);
-
-    int u, v; // endvertices, to read edges.
-    int i = 0;
-    while(i < m)
-    {
-        char comma;
-        if (instream.good() && !instream.eof()) {
-            instream >> u >> comma >> v;
-        } else {
-            fprintf(stderr, "problem with line %d in input file\n", i+2);
-            exit(1);
-        }
-        assert(u < n && u > -1);
-        assert(v < n && v > -1);
-        if(u==v)
-            fprintf(stderr, "Detected loop %d->%d\n", u, v);
-        assert(u != v);
-
-        adjList[u].push_back(v);
-
-        i++;
-    }
-
-#ifdef DEBUG
-    printArrayOfLinkedLists(adjList, n);
-#endif
-
-    return adjList;
-}
-#endif
-
 /*! \brief execute an clique algorithm, time it,
            and print the size of the maximum clique
            along with time information.
@@ -443,23 +393,103 @@ void RunAndPrintStats(Algorithm *pAlgorithm, list<list<int>> &cliques, bool cons
     fprintf(stderr, "%s: ", pAlgorithm->GetName().c_str());
     fflush(stderr);
 
-    clock_t const start = clock();
+    // wall-clock time, as clock() adds up the time of all threads.
+    chrono::steady_clock::time_point const start = chrono::steady_clock::now();
 
     long const cliqueCount = pAlgorithm->Run(cliques);
 
-    clock_t const end = clock();
+    chrono::steady_clock::time_point const end = chrono::steady_clock::now();
+
+    double const seconds(chrono::duration<double>(end - start).count());
 
     int const cliqueNumber(cliques.empty()? -1: cliques.back().size());
 
-    if (!outputLatex) {
+    SearchLimits const *pLimits(pAlgorithm->GetSearchLimits());
+
+    if (!outputLatex && pLimits != nullptr && pLimits->Stopped()) {
+        fprintf(stderr, "Found clique of size %d ", cliqueNumber);
+        fprintf(stderr, "in %f seconds ", seconds);
+        fprintf(stderr, "(%s, upper bound %zu)\n", pLimits->GetStatus().c_str(), max(static_cast<size_t>(max(cliqueNumber, 0)), pAlgorithm->GetUpperBound()));
+    } else if (!outputLatex) {
         fprintf(stderr, "Found maximum clique of size %d ", cliqueNumber);
-        fprintf(stderr, "in %f seconds\n", (double)(end-start)/(double)(CLOCKS_PER_SEC));
+        fprintf(stderr, "in %f seconds", seconds);
+        fprintf(stderr, (pLimits != nullptr) ? " (optimal)\n" : "\n");
     } else {
-        printf("%.2f", (double)(end-start)/(double)(CLOCKS_PER_SEC));
+        printf("%.2f", seconds);
     }
     fflush(stderr);
 }
 
+static string JsonString(string const &value)
+{
+    string escaped("\"");
+    for (char const character : value) {
+        if (character == '"' || character == '\\') escaped += '\\';
+        escaped += character;
+    }
+    return escaped + "\"";
+}
+
+// csv fields are quoted, as file names may contain commas.
+static string CsvString(string const &value)
+{
+    string escaped("\"");
+    for (char const character : value) {
+        if (character == '"') escaped += '"';
+        escaped += character;
+    }
+    return escaped + "\"";
+}
+
+void PrintRecordHeader(string const &outputFormat)
+{
+    if (outputFormat == "csv") {
+        printf("graph,n,m,algorithm,status,clique_size,upper_bound,clique,wall_seconds,cpu_seconds,time_to_best_seconds,nodes,peak_memory_kb\n");
+    }
+}
+
+void RunAndPrintRecord(Algorithm *pAlgorithm, list<list<int>> &cliques, string const &outputFormat, string const &graphName, size_t const numVertices, size_t const numEdges)
+{
+    chrono::steady_clock::time_point const start = chrono::steady_clock::now();
+    clock_t const startClock(clock());
+
+    pAlgorithm->Run(cliques);
+
+    clock_t const endClock(clock());
+    chrono::steady_clock::time_point const end = chrono::steady_clock::now();
+
+    double const wallSeconds(chrono::duration<double>(end - start).count());
+    double const cpuSeconds(static_cast<double>(endClock - startClock)/CLOCKS_PER_SEC);
+
+    // on the same clock, and from the same start, as the wall-clock time.
+    chrono::steady_clock::time_point const bestTime(pAlgorithm->GetTimeOfLargestClique());
+    double const timeToBestSeconds((bestTime < start) ? 0.0 : chrono::duration<double>(bestTime - start).count());
+
+    list<int> const emptyClique;
+    list<int> const &clique(cliques.empty() ? emptyClique : cliques.back());
+
+    SearchLimits const *pLimits(pAlgorithm->GetSearchLimits());
+    string const status((pLimits != nullptr) ? pLimits->GetStatus() : "optimal");
+    size_t const upperBound((pLimits != nullptr && pLimits->Stopped()) ? max(clique.size(), pAlgorithm->GetUpperBound()) : clique.size());
+
+    string vertices;
+    for (int const vertex : clique) {
+        if (!vertices.empty()) vertices += (outputFormat == "json") ? ", " : " ";
+        vertices += to_string(vertex);
+    }
+
+    if (outputFormat == "json") {
+        printf("{\"graph\": %s, \"n\": %zu, \"m\": %zu, \"algorithm\": %s, \"status\": \"%s\", \"clique_size\": %zu, \"upper_bound\": %zu, \"clique\": [%s], ",
+               JsonString(graphName).c_str(), numVertices, numEdges, JsonString(pAlgorithm->GetName()).c_str(), status.c_str(), clique.size(), upperBound, vertices.c_str());
+        printf("\"wall_seconds\": %f, \"cpu_seconds\": %f, \"time_to_best_seconds\": %f, \"nodes\": %zu, \"peak_memory_kb\": %zu}\n",
+               wallSeconds, cpuSeconds, timeToBestSeconds, pAlgorithm->GetNodeCount(), PeakResidentSetSizeInKB());
+    } else {
+        printf("%s,%zu,%zu,%s,%s,%zu,%zu,%s,", CsvString(graphName).c_str(), numVertices, numEdges, pAlgorithm->GetName().c_str(), status.c_str(), clique.size(), upperBound, vertices.c_str());
+        printf("%f,%f,%f,%zu,%zu\n", wallSeconds, cpuSeconds, timeToBestSeconds, pAlgorithm->GetNodeCount(), PeakResidentSetSizeInKB());
+    }
+    fflush(stdout);
+}
+
 /*! \brief Print the items in the linked list.
 
     \param linkedList A linked list.
@@ -67,6 +67,11 @@ void runAndPrintStatsMatrix(long (*function)(char**,
 
 void RunAndPrintStats(Algorithm* pAlgorithm, std::list<std::list<int>> &cliques, bool const outputLatex);
 
+// Runs the algorithm, and prints the result to stdout as one record, in
+// outputFormat json or csv, for scripts that run many searches.
+void RunAndPrintRecord(Algorithm* pAlgorithm, std::list<std::list<int>> &cliques, std::string const &outputFormat, std::string const &graphName, size_t const numVertices, size_t const numEdges);
+void PrintRecordHeader(std::string const &outputFormat);
+
 void printListAbbv(std::list<int> const &linkedList, void (*printFunc)(int));
 
 /*! \brief process a clique, which may include printing it in
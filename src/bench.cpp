@@ -0,0 +1,317 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+// local includes
+#include "CSRGraph.h"
+#include "GraphReader.h"
+#include "GraphGenerator.h"
+#include "SearchLimits.h"
+#include "MCQ.h"
+#include "MCR.h"
+#include "StaticOrderMCS.h"
+#include "MCS.h"
+#include "MISQ.h"
+#include "MISR.h"
+#include "StaticOrderMISS.h"
+#include "MISS.h"
+#include "SparseMCS.h"
+
+// system includes
+#include <map>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+
+using namespace std;
+
+/*! \file bench.cpp
+
+    \brief Runs each algorithm over a list of instances, with warmup runs and
+           repeats, and reports the median and minimum times, search nodes
+           per second, and the speedup over a saved baseline. Instances are
+           graph files, or specifications of synthetic graphs (see
+           GraphGenerator.h), so that the default suite needs no data files.
+*/
+
+// fixed seeds, sized so that every algorithm solves each in about a second or less.
+static char const *DefaultInstances() { return "gnp:200:0.5:1,gnp:150:0.7:2,gnp:90:0.9:3,brock:200:0.7:20:4,san:200:0.7:15:5"; }
+static char const *DefaultAlgorithms() { return "mcq,mcr,static-order-mcs,mcs,misq,misr,static-order-miss,miss"; }
+
+struct BenchResult
+{
+    string instance;
+    string algorithm;
+    size_t cliqueSize;
+    size_t nodeCount;
+    double medianSeconds;
+    double minSeconds;
+    bool   bTimedOut;
+};
+
+vector<string> Split(string const &list)
+{
+    vector<string> vItems;
+    size_t start(0);
+    while (start <= list.size()) {
+        size_t const end(min(list.find(',', start), list.size()));
+        if (end > start) vItems.push_back(list.substr(start, end - start));
+        start = end + 1;
+    }
+    return vItems;
+}
+
+bool IsIndependentSetAlgorithm(string const &name)
+{
+    return name == "misq" || name == "misr" || name == "static-order-miss" || name == "miss";
+}
+
+// the independent set algorithms get the complement, so that every algorithm
+// solves the same problem, and their sizes must agree.
+MaxSubgraphAlgorithm *CreateAlgorithm(string const &name, vector<vector<char>> const &vAdjacencyMatrix, vector<vector<char>> const &vComplementMatrix, vector<vector<int>> const &adjacencyArray)
+{
+    if (name == "mcq")               return new MCQ(vAdjacencyMatrix);
+    if (name == "mcr")               return new MCR(vAdjacencyMatrix);
+    if (name == "static-order-mcs")  return new StaticOrderMCS(vAdjacencyMatrix);
+    if (name == "mcs")               return new MCS(vAdjacencyMatrix);
+    if (name == "misq")              return new MISQ(vComplementMatrix);
+    if (name == "misr")              return new MISR(vComplementMatrix);
+    if (name == "static-order-miss") return new StaticOrderMISS(vComplementMatrix);
+    if (name == "miss")              return new MISS(vComplementMatrix);
+    if (name == "sparse-mcs")        return new SparseMCS(adjacencyArray);
+    return nullptr;
+}
+
+// the value of "key" in a line of a baseline file, which holds one result per line.
+string JsonField(string const &line, string const &key)
+{
+    string const quotedKey("\"" + key + "\":");
+    size_t position(line.find(quotedKey));
+    if (position == string::npos) return "";
+    position = line.find_first_not_of(' ', position + quotedKey.size());
+    if (position == string::npos) return "";
+    if (line[position] == '"') {
+        size_t const end(line.find('"', position + 1));
+        return line.substr(position + 1, end - position - 1);
+    }
+    size_t const end(line.find_first_of(",}", position));
+    return line.substr(position, end - position);
+}
+
+map<pair<string,string>, BenchResult> ReadBaseline(string const &fileName)
+{
+    ifstream input(fileName.c_str());
+    if (!input.good()) {
+        cout << "ERROR: Unable to open baseline " << fileName << endl;
+        exit(1);
+    }
+
+    map<pair<string,string>, BenchResult> baseline;
+    string line;
+    while (getline(input, line)) {
+        if (line.find("\"instance\"") == string::npos) continue;
+        BenchResult result;
+        result.instance      = JsonField(line, "instance");
+        result.algorithm     = JsonField(line, "algorithm");
+        result.cliqueSize    = strtoull(JsonField(line, "clique_size").c_str(), nullptr, 10);
+        result.nodeCount     = strtoull(JsonField(line, "nodes").c_str(), nullptr, 10);
+        result.medianSeconds = atof(JsonField(line, "median_seconds").c_str());
+        result.minSeconds    = atof(JsonField(line, "min_seconds").c_str());
+        result.bTimedOut     = JsonField(line, "timed_out") == "true";
+        baseline[make_pair(result.instance, result.algorithm)] = result;
+    }
+    return baseline;
+}
+
+void WriteBaseline(string const &fileName, vector<BenchResult> const &vResults)
+{
+    FILE *pFile(fopen(fileName.c_str(), "w"));
+    if (pFile == nullptr) {
+        fprintf(stderr, "ERROR: Unable to open file %s for writing\n", fileName.c_str());
+        exit(1);
+    }
+
+    fprintf(pFile, "{\n  \"results\": [");
+    for (size_t index = 0; index < vResults.size(); ++index) {
+        BenchResult const &result(vResults[index]);
+        fprintf(pFile, "%s\n    {\"instance\": \"%s\", \"algorithm\": \"%s\", \"clique_size\": %zu, \"nodes\": %zu, \"median_seconds\": %.6f, \"min_seconds\": %.6f, \"timed_out\": %s}",
+                index == 0 ? "" : ",", result.instance.c_str(), result.algorithm.c_str(), result.cliqueSize, result.nodeCount, result.medianSeconds, result.minSeconds, result.bTimedOut ? "true" : "false");
+    }
+    fprintf(pFile, "\n  ]\n}\n");
+    fclose(pFile);
+}
+
+BenchResult MeasureAlgorithm(string const &instance, string const &name, vector<vector<char>> const &vAdjacencyMatrix, vector<vector<char>> const &vComplementMatrix, vector<vector<int>> const &adjacencyArray, int const numWarmups, int const numRepeats, double const timeLimit)
+{
+    BenchResult result = {instance, name, 0, 0, 0.0, 0.0, false};
+    vector<double> vSeconds;
+
+    for (int run = 0; run < numWarmups + numRepeats; ++run) {
+        MaxSubgraphAlgorithm *pAlgorithm(CreateAlgorithm(name, vAdjacencyMatrix, vComplementMatrix, adjacencyArray));
+        pAlgorithm->SetQuiet(true);
+
+        SearchLimits limits(timeLimit, 0);
+        if (timeLimit > 0.0) pAlgorithm->SetSearchLimits(&limits);
+
+        list<list<int>> cliques;
+        limits.Start();
+        chrono::steady_clock::time_point const start(chrono::steady_clock::now());
+        pAlgorithm->Run(cliques);
+        double const seconds(chrono::duration<double>(chrono::steady_clock::now() - start).count());
+
+        result.cliqueSize = cliques.empty() ? 0 : cliques.back().size();
+        result.nodeCount  = pAlgorithm->GetNodeCount();
+        result.bTimedOut  = limits.Stopped();
+        delete pAlgorithm;
+
+        // a search that timed out will again, don't repeat it.
+        if (result.bTimedOut) {
+            result.medianSeconds = result.minSeconds = seconds;
+            return result;
+        }
+
+        if (run >= numWarmups) vSeconds.push_back(seconds);
+    }
+
+    sort(vSeconds.begin(), vSeconds.end());
+    size_t const middle(vSeconds.size()/2);
+    result.medianSeconds = (vSeconds.size()%2 == 1) ? vSeconds[middle] : (vSeconds[middle-1] + vSeconds[middle])/2.0;
+    result.minSeconds    = vSeconds.front();
+    return result;
+}
+
+void ProcessCommandLineArgs(int const argc, char** argv, map<string,string> &mapCommandLineArgs)
+{
+    for (int i = 1; i < argc; ++i) {
+        string const argument(argv[i]);
+        size_t const positionOfEquals(argument.find_first_of("="));
+        if (positionOfEquals != string::npos) {
+            string const key  (argument.substr(0,positionOfEquals));
+            string const value(argument.substr(positionOfEquals+1));
+            mapCommandLineArgs[key] = value;
+        } else {
+            mapCommandLineArgs[argument] = "";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    map<string,string> mapCommandLineArgs;
+
+    ProcessCommandLineArgs(argc, argv, mapCommandLineArgs);
+
+    string const instances((mapCommandLineArgs.find("--instances") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--instances"] : DefaultInstances());
+    string const algorithms((mapCommandLineArgs.find("--algorithms") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--algorithms"] : DefaultAlgorithms());
+    int    const numWarmups((mapCommandLineArgs.find("--warmup") != mapCommandLineArgs.end()) ? atoi(mapCommandLineArgs["--warmup"].c_str()) : 1);
+    int    const numRepeats((mapCommandLineArgs.find("--repeat") != mapCommandLineArgs.end()) ? atoi(mapCommandLineArgs["--repeat"].c_str()) : 3);
+    double const timeLimit((mapCommandLineArgs.find("--time-limit") != mapCommandLineArgs.end()) ? atof(mapCommandLineArgs["--time-limit"].c_str()) : 0.0);
+    string const baselineFile((mapCommandLineArgs.find("--baseline") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--baseline"] : "");
+    string const saveBaselineFile((mapCommandLineArgs.find("--save-baseline") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--save-baseline"] : "");
+
+    vector<string> const vInstances(Split(instances));
+    vector<string> const vAlgorithms(Split(algorithms));
+
+    if (mapCommandLineArgs.find("--help") != mapCommandLineArgs.end() || numWarmups < 0 || numRepeats < 1 || timeLimit < 0.0 || vInstances.empty() || vAlgorithms.empty()) {
+        cout << "usage: " << argv[0] << " [--instances=<comma-separated graph files or gnp:n:p[:seed], brock:n:p:k[:seed], san:n:p:k[:seed]>] [--algorithms=<comma-separated algorithm names>] [--warmup=<runs>] [--repeat=<runs>] [--time-limit=<seconds per run>] [--baseline=<json file>] [--save-baseline=<json file>]" << endl;
+        return 1;
+    }
+
+    vector<vector<char>> vEmptyMatrix;
+    vector<vector<int>>  vEmptyArray;
+    for (string const &name : vAlgorithms) {
+        MaxSubgraphAlgorithm *pAlgorithm(CreateAlgorithm(name, vEmptyMatrix, vEmptyMatrix, vEmptyArray));
+        if (pAlgorithm == nullptr) {
+            cout << "ERROR: unrecognized algorithm name " << name << endl;
+            return 1;
+        }
+        delete pAlgorithm;
+    }
+
+    map<pair<string,string>, BenchResult> baseline;
+    if (!baselineFile.empty()) baseline = ReadBaseline(baselineFile);
+
+    printf("%-24s %-18s %6s %12s %12s %12s %12s %9s\n", "instance", "algorithm", "size", "nodes", "median s", "min s", "Mnodes/s", "speedup");
+
+    vector<BenchResult> vResults;
+    bool bMismatch(false);
+
+    for (string const &instance : vInstances) {
+        CSRGraph graph;
+        if (GraphGenerator::IsSpecification(instance)) {
+            GraphGenerator::Generate(instance, graph);
+        } else {
+            GraphReader::Read(instance, GraphReader::FormatForFile(instance), graph, max(1, static_cast<int>(thread::hardware_concurrency())));
+        }
+
+        if (graph.NumVertices() >= 20000) {
+            cout << "ERROR: the benchmark builds adjacency matrices, and the graph is too large: " << instance << endl;
+            return 1;
+        }
+
+        vector<vector<char>> vAdjacencyMatrix;
+        vector<vector<char>> vComplementMatrix;
+        vector<vector<int>>  adjacencyArray;
+        graph.BuildAdjacencyMatrix(vAdjacencyMatrix, false);
+        graph.BuildAdjacencyMatrix(vComplementMatrix, true);
+        for (size_t vertex = 0; vertex < vComplementMatrix.size(); ++vertex) {
+            for (size_t other = 0; other < vComplementMatrix.size(); ++other) {
+                if (vertex != other) vComplementMatrix[vertex][other] = !vComplementMatrix[vertex][other];
+            }
+        }
+        graph.BuildAdjacencyArray(adjacencyArray);
+
+        size_t uSolvedSize(0); // by the first algorithm to finish on this instance
+        for (string const &name : vAlgorithms) {
+            BenchResult const result(MeasureAlgorithm(instance, name, vAdjacencyMatrix, vComplementMatrix, adjacencyArray, numWarmups, numRepeats, timeLimit));
+            vResults.push_back(result);
+
+            double const nodesPerSecond(result.medianSeconds > 0.0 ? result.nodeCount/result.medianSeconds : 0.0);
+
+            string speedup("-");
+            auto const baselineResult(baseline.find(make_pair(instance, name)));
+            if (baselineResult != baseline.end() && !result.bTimedOut && !baselineResult->second.bTimedOut && result.medianSeconds > 0.0) {
+                char buffer[32];
+                snprintf(buffer, sizeof(buffer), "%.2fx", baselineResult->second.medianSeconds/result.medianSeconds);
+                speedup = buffer;
+            }
+
+            printf("%-24s %-18s %6zu %12zu %12.6f %12.6f %12.3f %9s%s\n", instance.c_str(), name.c_str(), result.cliqueSize, result.nodeCount,
+                   result.medianSeconds, result.minSeconds, nodesPerSecond/1e6, speedup.c_str(), result.bTimedOut ? " (timed out)" : "");
+            fflush(stdout);
+
+            if (!result.bTimedOut && uSolvedSize != 0 && result.cliqueSize != uSolvedSize) {
+                printf("ERROR: %s found size %zu on %s, other algorithms found %zu\n", name.c_str(), result.cliqueSize, instance.c_str(), uSolvedSize);
+                bMismatch = true;
+            }
+            if (!result.bTimedOut && uSolvedSize == 0) uSolvedSize = result.cliqueSize;
+
+            // a completed search must find a set of the same size as the baseline's.
+            if (baselineResult != baseline.end() && !result.bTimedOut && !baselineResult->second.bTimedOut && baselineResult->second.cliqueSize != result.cliqueSize) {
+                printf("ERROR: %s found size %zu on %s, the baseline found %zu\n", name.c_str(), result.cliqueSize, instance.c_str(), baselineResult->second.cliqueSize);
+                bMismatch = true;
+            }
+        }
+    }
+
+    if (!saveBaselineFile.empty()) WriteBaseline(saveBaselineFile, vResults);
+
+    return bMismatch ? 1 : 0;
+}
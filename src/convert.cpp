@@ -0,0 +1,78 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+// local includes
+#include "CSRGraph.h"
+#include "GraphReader.h"
+
+// system includes
+#include <map>
+#include <string>
+#include <thread>
+#include <iostream>
+#include <algorithm>
+
+using namespace std;
+
+/*! \file convert.cpp
+
+    \brief Converts a graph in .graph (METIS), .edges, or DIMACS format to the binary
+           CSR format, which open-mcs maps directly into memory.
+*/
+
+void ProcessCommandLineArgs(int const argc, char** argv, map<string,string> &mapCommandLineArgs)
+{
+    for (int i = 1; i < argc; ++i) {
+        string const argument(argv[i]);
+        size_t const positionOfEquals(argument.find_first_of("="));
+        if (positionOfEquals != string::npos) {
+            string const key  (argument.substr(0,positionOfEquals));
+            string const value(argument.substr(positionOfEquals+1));
+            mapCommandLineArgs[key] = value;
+        } else {
+            mapCommandLineArgs[argument] = "";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    map<string,string> mapCommandLineArgs;
+
+    ProcessCommandLineArgs(argc, argv, mapCommandLineArgs);
+
+    string const inputFile((mapCommandLineArgs.find("--input-file") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--input-file"] : "");
+    string const outputFile((mapCommandLineArgs.find("--output-file") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--output-file"] : "");
+    string const format((mapCommandLineArgs.find("--format") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--format"] : "");
+
+    if (inputFile.empty() || outputFile.empty()) {
+        cout << "usage: " << argv[0] << " --input-file=<.graph, .edges, or .clq file> --output-file=<.csr file> [--format=<metis|edges|dimacs>]" << endl;
+        return 1;
+    }
+
+    int const numReaderThreads(max(1, static_cast<int>(thread::hardware_concurrency())));
+
+    string const graphFormat(format.empty() ? GraphReader::FormatForFile(inputFile) : format);
+
+    CSRGraph graph;
+    cout << "Reading " << graphFormat << " file format. " << endl << flush;
+    GraphReader::Read(inputFile, graphFormat, graph, numReaderThreads);
+
+    graph.Write(outputFile);
+
+    cout << "Wrote " << graph.NumVertices() << " vertices and " << graph.NumEntries()/2 << " edges to " << outputFile << endl;
+
+    return 0;
+}
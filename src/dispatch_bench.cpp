@@ -0,0 +1,170 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+// local includes
+#include "CSRGraph.h"
+#include "GraphReader.h"
+#include "MCQ.h"
+#include "MCR.h"
+#include "StaticOrderMCS.h"
+#include "MCS.h"
+#include "MISQ.h"
+#include "MISR.h"
+#include "StaticOrderMISS.h"
+#include "MISS.h"
+#include "SparseMCS.h"
+
+// system includes
+#include <map>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+using namespace std;
+
+/*! \file dispatch_bench.cpp
+
+    \brief Measures the time per search node of each algorithm, with the
+           search hooks called through the vtable (the generic
+           MaxSubgraphAlgorithm::RunRecursive) and called directly (the
+           algorithm's own RunRecursiveStatic instantiation).
+*/
+
+// Runs Base with the generic, virtually dispatched search.
+template <class Base>
+class VirtualDispatch : public Base
+{
+public:
+    template <class GraphType>
+    VirtualDispatch(GraphType const &graph) : Base(graph) {}
+
+    virtual void RunRecursive(vector<int> &P, vector<int> &vVertexOrder, list<list<int>> &cliques, vector<int> &vColors)
+    {
+        MaxSubgraphAlgorithm::RunRecursive(P, vVertexOrder, cliques, vColors);
+    }
+};
+
+struct Measurement
+{
+    double seconds;
+    size_t nodeCount;
+    size_t cliqueSize;
+};
+
+// best of numRepeats runs.
+template <class AlgorithmType, class GraphType>
+Measurement MeasureSearch(GraphType const &graph, int const numRepeats)
+{
+    Measurement best = {0.0, 0, 0};
+    for (int repeat = 0; repeat < numRepeats; ++repeat) {
+        AlgorithmType algorithm(graph);
+        list<list<int>> cliques;
+
+        chrono::steady_clock::time_point const start(chrono::steady_clock::now());
+        algorithm.Run(cliques);
+        double const seconds(chrono::duration<double>(chrono::steady_clock::now() - start).count());
+
+        if (repeat == 0 || seconds < best.seconds) {
+            best.seconds    = seconds;
+            best.nodeCount  = algorithm.GetNodeCount();
+            best.cliqueSize = cliques.empty() ? 0 : cliques.back().size();
+        }
+    }
+    return best;
+}
+
+template <class AlgorithmType, class GraphType>
+void CompareDispatch(string const &name, GraphType const &graph, int const numRepeats)
+{
+    Measurement const virtualSearch(MeasureSearch<VirtualDispatch<AlgorithmType>>(graph, numRepeats));
+    Measurement const staticSearch(MeasureSearch<AlgorithmType>(graph, numRepeats));
+
+    double const virtualNanoseconds(virtualSearch.seconds*1e9/max(virtualSearch.nodeCount, static_cast<size_t>(1)));
+    double const staticNanoseconds(staticSearch.seconds*1e9/max(staticSearch.nodeCount, static_cast<size_t>(1)));
+
+    printf("%-18s %8zu %12zu %14.1f %14.1f %8.2fx\n", name.c_str(), staticSearch.cliqueSize, staticSearch.nodeCount, virtualNanoseconds, staticNanoseconds, virtualNanoseconds/staticNanoseconds);
+
+    if (virtualSearch.nodeCount != staticSearch.nodeCount || virtualSearch.cliqueSize != staticSearch.cliqueSize) {
+        printf("ERROR: %s searched %zu nodes (size %zu) with virtual dispatch, and %zu nodes (size %zu) without\n", name.c_str(), virtualSearch.nodeCount, virtualSearch.cliqueSize, staticSearch.nodeCount, staticSearch.cliqueSize);
+    }
+}
+
+void ProcessCommandLineArgs(int const argc, char** argv, map<string,string> &mapCommandLineArgs)
+{
+    for (int i = 1; i < argc; ++i) {
+        string const argument(argv[i]);
+        size_t const positionOfEquals(argument.find_first_of("="));
+        if (positionOfEquals != string::npos) {
+            string const key  (argument.substr(0,positionOfEquals));
+            string const value(argument.substr(positionOfEquals+1));
+            mapCommandLineArgs[key] = value;
+        } else {
+            mapCommandLineArgs[argument] = "";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    map<string,string> mapCommandLineArgs;
+
+    ProcessCommandLineArgs(argc, argv, mapCommandLineArgs);
+
+    string const inputFile((mapCommandLineArgs.find("--input-file") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--input-file"] : "");
+    string const format((mapCommandLineArgs.find("--format") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--format"] : "");
+    string const algorithm((mapCommandLineArgs.find("--algorithm") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--algorithm"] : "all");
+    int    const numRepeats((mapCommandLineArgs.find("--repeat") != mapCommandLineArgs.end()) ? atoi(mapCommandLineArgs["--repeat"].c_str()) : 3);
+
+    if (inputFile.empty() || numRepeats < 1) {
+        cout << "usage: " << argv[0] << " --input-file=<filename> [--format=<metis|edges|dimacs|csr>] [--algorithm=<all|mcq|mcr|static-order-mcs|mcs|misq|misr|static-order-miss|miss|sparse-mcs>] [--repeat=<number of runs, best is reported>]" << endl;
+        return 1;
+    }
+
+    string const graphFormat(format.empty() ? GraphReader::FormatForFile(inputFile) : format);
+    CSRGraph graph;
+    GraphReader::Read(inputFile, graphFormat, graph, max(1, static_cast<int>(thread::hardware_concurrency())));
+
+    if (graph.NumVertices() >= 20000) {
+        cout << "ERROR: the benchmark builds adjacency matrices, and the graph is too large: " << graph.NumVertices() << endl;
+        return 1;
+    }
+
+    vector<vector<char>> vAdjacencyMatrix;
+    vector<vector<char>> vAdjacencyMatrixWithDiagonals;
+    vector<vector<int>>  adjacencyArray;
+    graph.BuildAdjacencyMatrix(vAdjacencyMatrix, false);
+    graph.BuildAdjacencyMatrix(vAdjacencyMatrixWithDiagonals, true);
+    graph.BuildAdjacencyArray(adjacencyArray);
+
+    printf("%-18s %8s %12s %14s %14s %9s\n", "algorithm", "size", "nodes", "virtual ns/node", "static ns/node", "speedup");
+
+    auto selected = [&algorithm](string const &name) { return algorithm == "all" || algorithm == name; };
+
+    if (selected("mcq"))               CompareDispatch<MCQ>("mcq", vAdjacencyMatrix, numRepeats);
+    if (selected("mcr"))               CompareDispatch<MCR>("mcr", vAdjacencyMatrix, numRepeats);
+    if (selected("static-order-mcs"))  CompareDispatch<StaticOrderMCS>("static-order-mcs", vAdjacencyMatrix, numRepeats);
+    if (selected("mcs"))               CompareDispatch<MCS>("mcs", vAdjacencyMatrix, numRepeats);
+    if (selected("misq"))              CompareDispatch<MISQ>("misq", vAdjacencyMatrixWithDiagonals, numRepeats);
+    if (selected("misr"))              CompareDispatch<MISR>("misr", vAdjacencyMatrixWithDiagonals, numRepeats);
+    if (selected("static-order-miss")) CompareDispatch<StaticOrderMISS>("static-order-miss", vAdjacencyMatrixWithDiagonals, numRepeats);
+    if (selected("miss"))              CompareDispatch<MISS>("miss", vAdjacencyMatrixWithDiagonals, numRepeats);
+    if (selected("sparse-mcs"))        CompareDispatch<SparseMCS>("sparse-mcs", adjacencyArray, numRepeats);
+
+    return 0;
+}
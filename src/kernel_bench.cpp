@@ -0,0 +1,283 @@
+/* 
+    This program is free software: you can redistribute it and/or modify 
+    it under the terms of the GNU General Public License as published by 
+    the Free Software Foundation, either version 3 of the License, or 
+    (at your option) any later version. 
+ 
+    This program is distributed in the hope that it will be useful, 
+    but WITHOUT ANY WARRANTY; without even the implied warranty of 
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the 
+    GNU General Public License for more details. 
+ 
+    You should have received a copy of the GNU General Public License 
+    along with this program.  If not, see <http://www.gnu.org/licenses/> 
+*/
+
+// local includes
+#include "KernelInputs.h"
+#include "PerfCounters.h"
+#include "CandidateFilters.h"
+#include "CliqueColoringStrategy.h"
+#include "BitSetCliqueColoringStrategy.h"
+#include "SparseCliqueColoringStrategy.h"
+#include "IndependentSetColoringStrategy.h"
+
+// system includes
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+
+using namespace std;
+
+/*! \file kernel_bench.cpp
+
+    \brief Replays the kernel inputs sampled from a search (open-mcs
+           --dump-kernel-inputs) through each coloring strategy and each
+           candidate filter in isolation, and reports the time and, where
+           hardware counters are available, the cache misses per vertex.
+
+           Inputs sampled from an independent set search are replayed on the
+           complement graph, so that the clique kernels see the same
+           problem, and the independent set kernels on the complement of
+           that; every coloring kernel gets the same orders.
+*/
+
+// a kernel takes one sample, and returns the size of its result, which must
+// be the same for kernels that compute the same thing.
+struct Kernel
+{
+    string name;
+    bool   bFilter; // replays the parent order, instead of the order to color
+    function<size_t(KernelInputs::Sample const &)> run;
+};
+
+void ProcessCommandLineArgs(int const argc, char** argv, map<string,string> &mapCommandLineArgs)
+{
+    for (int i = 1; i < argc; ++i) {
+        string const argument(argv[i]);
+        size_t const positionOfEquals(argument.find_first_of("="));
+        if (positionOfEquals != string::npos) {
+            string const key  (argument.substr(0,positionOfEquals));
+            string const value(argument.substr(positionOfEquals+1));
+            mapCommandLineArgs[key] = value;
+        } else {
+            mapCommandLineArgs[argument] = "";
+        }
+    }
+}
+
+vector<string> Split(string const &list)
+{
+    vector<string> vItems;
+    size_t start(0);
+    while (start <= list.size()) {
+        size_t const comma(list.find(',', start));
+        string const item(list.substr(start, comma == string::npos ? string::npos : comma - start));
+        if (!item.empty()) vItems.push_back(item);
+        if (comma == string::npos) break;
+        start = comma + 1;
+    }
+    return vItems;
+}
+
+// the largest color given to the order, the bound the search prunes with.
+size_t LargestColor(vector<int> const &vColors)
+{
+    return vColors.empty() ? 0 : *max_element(vColors.begin(), vColors.end());
+}
+
+int main(int argc, char** argv)
+{
+    map<string,string> mapCommandLineArgs;
+
+    ProcessCommandLineArgs(argc, argv, mapCommandLineArgs);
+
+    string const inputFile((mapCommandLineArgs.find("--input-file") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--input-file"] : "");
+    string const kernels((mapCommandLineArgs.find("--kernels") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--kernels"] : "all");
+    double const minimumSeconds((mapCommandLineArgs.find("--min-seconds") != mapCommandLineArgs.end()) ? atof(mapCommandLineArgs["--min-seconds"].c_str()) : 0.5);
+
+    if (inputFile.empty() || minimumSeconds < 0.0) {
+        cout << "usage: " << argv[0] << " --input-file=<kernel inputs, from open-mcs --dump-kernel-inputs> [--kernels=<all|comma-separated kernel names>] [--min-seconds=<time per kernel>]" << endl;
+        return 1;
+    }
+
+    KernelInputs inputs(1, 0);
+    vector<vector<int>> vGraph;
+    bool bIndependentSet(false);
+    inputs.Read(inputFile, vGraph, bIndependentSet);
+
+    size_t const numVertices(vGraph.size());
+    bool const bDense(numVertices < 20000);
+
+    if (bIndependentSet && !bDense) {
+        cout << "ERROR: the inputs are from an independent set search, and the graph is too large to complement: " << numVertices << endl;
+        return 1;
+    }
+
+    // the graph in which the samples are cliques, as a matrix and as sorted
+    // arrays, and its complement (with diagonals) for the independent set kernels.
+    vector<vector<char>> vCliqueMatrix;
+    vector<vector<char>> vIndependentSetMatrix;
+    vector<vector<int>>  vCliqueArray;
+    if (bDense) {
+        vCliqueMatrix.assign(numVertices, vector<char>(numVertices, 0));
+        for (size_t vertex = 0; vertex < numVertices; ++vertex) {
+            for (int const neighbor : vGraph[vertex]) {
+                if (static_cast<size_t>(neighbor) != vertex) vCliqueMatrix[vertex][neighbor] = 1;
+            }
+        }
+
+        if (bIndependentSet) {
+            for (size_t vertex = 0; vertex < numVertices; ++vertex) {
+                for (size_t other = 0; other < numVertices; ++other) {
+                    if (vertex != other) vCliqueMatrix[vertex][other] = !vCliqueMatrix[vertex][other];
+                }
+            }
+        }
+
+        vIndependentSetMatrix = vCliqueMatrix;
+        vCliqueArray.resize(numVertices);
+        for (size_t vertex = 0; vertex < numVertices; ++vertex) {
+            for (size_t other = 0; other < numVertices; ++other) {
+                if (vCliqueMatrix[vertex][other]) vCliqueArray[vertex].push_back(other);
+                vIndependentSetMatrix[vertex][other] = (vertex == other) ? 1 : !vCliqueMatrix[vertex][other];
+            }
+        }
+    } else {
+        vCliqueArray = vGraph;
+        for (vector<int> &neighbors : vCliqueArray) {
+            sort(neighbors.begin(), neighbors.end());
+        }
+    }
+
+    CliqueColoringStrategy         cliqueColoring(vCliqueMatrix);
+    BitSetCliqueColoringStrategy   bitSetColoring(vCliqueMatrix);
+    SparseCliqueColoringStrategy   sparseColoring(vCliqueArray);
+    IndependentSetColoringStrategy independentSetColoring(vIndependentSetMatrix);
+    if (bDense) bitSetColoring.SetVertexOrder(inputs.GetInitialOrder());
+
+    vector<int>  vOutput;
+    vector<int>  vColors;
+    vector<char> vbMarks(numVertices, 0);
+
+    // the coloring kernels, called as the search calls them.
+    auto color = [&vOutput, &vColors](ColoringStrategy &strategy, vector<vector<char>> const &adjacencyMatrix, KernelInputs::Sample const &sample) {
+        vOutput.resize(sample.vVertexOrder.size());
+        vColors.resize(sample.vVertexOrder.size());
+        strategy.Color(adjacencyMatrix, sample.vVertexOrder, vOutput, vColors);
+        return LargestColor(vColors);
+    };
+
+    auto recolor = [&vOutput, &vColors](ColoringStrategy &strategy, vector<vector<char>> const &adjacencyMatrix, KernelInputs::Sample const &sample) {
+        vOutput.resize(sample.vVertexOrder.size());
+        vColors.resize(sample.vVertexOrder.size());
+        strategy.Recolor(adjacencyMatrix, sample.vVertexOrder, vOutput, vColors, sample.bestCliqueSize, sample.cliqueSize);
+        return LargestColor(vColors);
+    };
+
+    vector<Kernel> vKernels;
+    if (bDense) {
+        vKernels.push_back({"clique-color",     false, [&](KernelInputs::Sample const &sample) { return color(cliqueColoring, vCliqueMatrix, sample); }});
+        vKernels.push_back({"clique-recolor",   false, [&](KernelInputs::Sample const &sample) { return recolor(cliqueColoring, vCliqueMatrix, sample); }});
+        vKernels.push_back({"bitset-color",     false, [&](KernelInputs::Sample const &sample) { return color(bitSetColoring, vCliqueMatrix, sample); }});
+        vKernels.push_back({"bitset-recolor",   false, [&](KernelInputs::Sample const &sample) { return recolor(bitSetColoring, vCliqueMatrix, sample); }});
+        vKernels.push_back({"is-color",         false, [&](KernelInputs::Sample const &sample) { return color(independentSetColoring, vIndependentSetMatrix, sample); }});
+        vKernels.push_back({"is-recolor",       false, [&](KernelInputs::Sample const &sample) { return recolor(independentSetColoring, vIndependentSetMatrix, sample); }});
+    }
+    vKernels.push_back({"sparse-color", false, [&](KernelInputs::Sample const &sample) {
+        vOutput.resize(sample.vVertexOrder.size());
+        vColors.resize(sample.vVertexOrder.size());
+        sparseColoring.Color(vCliqueArray, sample.vVertexOrder, vOutput, vColors);
+        return LargestColor(vColors);
+    }});
+    vKernels.push_back({"sparse-recolor", false, [&](KernelInputs::Sample const &sample) {
+        vOutput.resize(sample.vVertexOrder.size());
+        vColors.resize(sample.vVertexOrder.size());
+        sparseColoring.Recolor(vCliqueArray, sample.vVertexOrder, vOutput, vColors, sample.bestCliqueSize, sample.cliqueSize);
+        return LargestColor(vColors);
+    }});
+
+    if (bDense) {
+        vKernels.push_back({"filter-matrix", true, [&](KernelInputs::Sample const &sample) {
+            CandidateFilters::Neighbors(vCliqueMatrix, sample.vParentOrder, sample.chosenVertex, vOutput);
+            return vOutput.size();
+        }});
+        vKernels.push_back({"filter-complement", true, [&](KernelInputs::Sample const &sample) {
+            CandidateFilters::NonNeighbors(vIndependentSetMatrix, sample.vParentOrder, sample.chosenVertex, vOutput);
+            return vOutput.size();
+        }});
+    }
+    vKernels.push_back({"filter-marked", true, [&](KernelInputs::Sample const &sample) {
+        CandidateFilters::MarkedNeighbors(vCliqueArray, vbMarks, sample.vParentOrder, sample.chosenVertex, vOutput);
+        return vOutput.size();
+    }});
+    vKernels.push_back({"filter-searched", true, [&](KernelInputs::Sample const &sample) {
+        CandidateFilters::SearchedNeighbors(vCliqueArray, sample.vParentOrder, sample.chosenVertex, vOutput);
+        return vOutput.size();
+    }});
+
+    vector<string> const vSelected(Split(kernels));
+    auto selected = [&vSelected](string const &name) { return find(vSelected.begin(), vSelected.end(), "all") != vSelected.end() || find(vSelected.begin(), vSelected.end(), name) != vSelected.end(); };
+    for (string const &name : vSelected) {
+        if (name != "all" && find_if(vKernels.begin(), vKernels.end(), [&name](Kernel const &kernel) { return kernel.name == name; }) == vKernels.end()) {
+            cout << "ERROR: unknown kernel " << name << (bDense ? "" : " (or not available on a graph this large)") << endl;
+            return 1;
+        }
+    }
+
+    vector<KernelInputs::Sample> const &vSamples(inputs.GetSamples());
+    if (vSamples.empty()) {
+        cout << "ERROR: " << inputFile << " holds no samples" << endl;
+        return 1;
+    }
+
+    PerfCounters counters;
+    if (!counters.Available(PerfCounters::CacheMisses)) {
+        cout << "NOTE: hardware counters are not available, cache misses are not reported" << endl;
+    }
+
+    printf("%zu samples on a graph with %zu vertices, from %s search\n", vSamples.size(), numVertices, bIndependentSet ? "an independent set" : "a clique");
+    printf("%-20s %10s %12s %10s %14s %12s\n", "kernel", "passes", "vertices", "ns/vertex", "misses/vertex", "result");
+
+    for (Kernel const &kernel : vKernels) {
+        if (!selected(kernel.name)) continue;
+
+        size_t uVerticesPerPass(0);
+        for (KernelInputs::Sample const &sample : vSamples) {
+            uVerticesPerPass += kernel.bFilter ? sample.vParentOrder.size() : sample.vVertexOrder.size();
+        }
+
+        // pass over all samples until the time is up, the result is from the first.
+        size_t uResult(0);
+        size_t uPasses(0);
+        double seconds(0.0);
+        PerfCounters::Counts const before(counters.Read());
+        chrono::steady_clock::time_point const start(chrono::steady_clock::now());
+        do {
+            size_t uPassResult(0);
+            for (KernelInputs::Sample const &sample : vSamples) {
+                uPassResult += kernel.run(sample);
+            }
+            if (uPasses == 0) uResult = uPassResult;
+            uPasses++;
+            seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        } while (seconds < minimumSeconds);
+        PerfCounters::Counts const after(counters.Read());
+
+        double const totalVertices(static_cast<double>(max(uVerticesPerPass*uPasses, static_cast<size_t>(1))));
+        char misses[32] = "-";
+        if (counters.Available(PerfCounters::CacheMisses)) {
+            snprintf(misses, sizeof(misses), "%.4f", (after.value[PerfCounters::CacheMisses] - before.value[PerfCounters::CacheMisses])/totalVertices);
+        }
+
+        printf("%-20s %10zu %12zu %10.2f %14s %12zu\n", kernel.name.c_str(), uPasses, uVerticesPerPass, seconds*1e9/totalVertices, misses, uResult);
+    }
+
+    return 0;
+}
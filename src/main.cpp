@@ -17,12 +17,26 @@
 #include "ArraySet.h"
 #include "Tools.h"
 #include "CliqueTools.h"
+#include "CSRGraph.h"
+#include "GraphReader.h"
+#include "MemoryManager.h"
+#include "SearchLimits.h"
+#include "SearchCheckpoint.h"
+#include "SearchStatistics.h"
+#include "KernelInputs.h"
+#include "MaxSatBound.h"
+#include "PerfCounters.h"
 
 // maximum clique algorithms
 #include "MCQ.h"
 #include "MCR.h"
 #include "StaticOrderMCS.h"
 #include "MCS.h"
+#include "BitSetMCS.h"
+#include "SparseMCS.h"
+#include "DegeneracyMCS.h"
+#include "ComponentMISS.h"
+#include "SparseMISS.h"
 
 // maximum independent set algorithms
 #include "MISQ.h"
@@ -30,6 +44,7 @@
 #include "StaticOrderMISS.h"
 #include "MISS.h"
 
+#include "ParallelMaxSubgraphAlgorithm.h"
 
 // system includes
 #include <map>
@@ -40,6 +55,9 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <chrono>
+#include <thread>
+#include <algorithm>
 
 using namespace std;
 
@@ -62,7 +80,13 @@ using namespace std;
 
 bool isValidAlgorithm(string const &name)
 {
-    return (name == "mcq" || name == "mcr" || name == "static-order-mcs" || name == "mcs");
+    return (name == "mcq" || name == "mcr" || name == "static-order-mcs" || name == "mcs" || name == "bitset-mcs" || name == "sparse-mcs" || name == "degeneracy-mcs" ||
+            name == "misq" || name == "misr" || name == "static-order-miss" || name == "miss" || name == "sparse-miss");
+}
+
+bool isIndependentSetAlgorithm(string const &name)
+{
+    return (name == "misq" || name == "misr" || name == "static-order-miss" || name == "miss" || name == "sparse-miss");
 }
 
 void ProcessCommandLineArgs(int const argc, char** argv, map<string,string> &mapCommandLineArgs)
@@ -133,10 +157,30 @@ int main(int argc, char** argv)
     string const algorithm((mapCommandLineArgs.find("--algorithm") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--algorithm"] : "");
     bool   const bComputeIndependentSet(mapCommandLineArgs.find("--compute-independent-set") != mapCommandLineArgs.end());
     bool   const bPrintHeader(mapCommandLineArgs.find("--header") != mapCommandLineArgs.end());
+    string const coloring((mapCommandLineArgs.find("--coloring") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--coloring"] : "greedy");
+    bool   const bWorkStealing(mapCommandLineArgs.find("--work-stealing") != mapCommandLineArgs.end());
+    string const format((mapCommandLineArgs.find("--format") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--format"] : "");
+    int    const numThreads((mapCommandLineArgs.find("--threads") != mapCommandLineArgs.end()) ? atoi(mapCommandLineArgs["--threads"].c_str()) : 1);
+    double const timeLimit((mapCommandLineArgs.find("--time-limit") != mapCommandLineArgs.end()) ? atof(mapCommandLineArgs["--time-limit"].c_str()) : 0.0);
+    long long const nodeLimit((mapCommandLineArgs.find("--node-limit") != mapCommandLineArgs.end()) ? atoll(mapCommandLineArgs["--node-limit"].c_str()) : 0);
+    string const resumeFile((mapCommandLineArgs.find("--resume") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--resume"] : "");
+    string const checkpointFile((mapCommandLineArgs.find("--checkpoint") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--checkpoint"] : resumeFile);
+    string const outputFormat((mapCommandLineArgs.find("--output-format") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--output-format"] : "text");
+    string const statisticsFile((mapCommandLineArgs.find("--stats") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--stats"] : "");
+    bool   const bPerfCounters(mapCommandLineArgs.find("--perf-counters") != mapCommandLineArgs.end());
+    bool   const bMaxSatBound(mapCommandLineArgs.find("--maxsat-bound") != mapCommandLineArgs.end());
+    bool   const bReduce(mapCommandLineArgs.find("--reduce") != mapCommandLineArgs.end());
+    string const kernelInputsFile((mapCommandLineArgs.find("--dump-kernel-inputs") != mapCommandLineArgs.end()) ? mapCommandLineArgs["--dump-kernel-inputs"] : "");
+    int    const kernelInputsInterval((mapCommandLineArgs.find("--dump-kernel-interval") != mapCommandLineArgs.end()) ? atoi(mapCommandLineArgs["--dump-kernel-interval"].c_str()) : 16);
+    double const checkpointInterval((mapCommandLineArgs.find("--checkpoint-interval") != mapCommandLineArgs.end()) ? atof(mapCommandLineArgs["--checkpoint-interval"].c_str()) : 600.0);
 
     bool   const bTableMode(bOutputLatex || bOutputTable);
+    bool   const bRecordMode(outputFormat == "json" || outputFormat == "csv");
+
+    // only the result goes to stdout when it is parsed by a script.
+    bool   const bPrintProgress(!bTableMode && !bRecordMode);
 
-    if (!bTableMode) {
+    if (bPrintProgress) {
 #ifdef DEBUG_MESSAGE
         PrintDebugWarning();
 #endif //DEBUG_MESSAGE
@@ -149,7 +193,7 @@ int main(int argc, char** argv)
     }
 
     string name(algorithm);
-    if (!bTableMode && algorithm.empty()) {
+    if (bPrintProgress && algorithm.empty()) {
         cout << "NOTE: Missing algorithm name, using mcs." << endl;
         name = "mcs";
         // ShowUsageMessage();
@@ -157,12 +201,47 @@ int main(int argc, char** argv)
     }
 
     if (argc <= 1 || !isValidAlgorithm(name)) {
-        cout << "usage: " << argv[0] << " --input-file=<filename> [--compute-independent-set] --algorithm=<mcq|mcr|static-order-mcs|mcs [--latex] [--header]" << endl;
+        cout << "usage: " << argv[0] << " --input-file=<filename> [--compute-independent-set] --algorithm=<mcq|mcr|static-order-mcs|mcs|bitset-mcs|sparse-mcs|degeneracy-mcs|misq|misr|static-order-miss|miss|sparse-miss> [--format=<metis|edges|dimacs|csr>] [--coloring=<greedy|bitset|incremental>] [--threads=<number of threads> [--work-stealing]] [--time-limit=<seconds>] [--node-limit=<search nodes>] [--checkpoint=<filename> [--checkpoint-interval=<seconds>]] [--resume=<filename>] [--stats=<json filename>] [--dump-kernel-inputs=<filename> [--dump-kernel-interval=<children>]] [--perf-counters] [--maxsat-bound] [--reduce] [--output-format=<text|json|csv> [--header]] [--latex] [--header]" << endl;
+    }
+
+    if (outputFormat != "text" && !bRecordMode) {
+        cout << "ERROR: unrecognized output format " << outputFormat << endl;
+        return 1;
+    }
+
+    if (coloring != "greedy" && coloring != "bitset" && coloring != "incremental") {
+        cout << "ERROR: unrecognized coloring " << coloring << endl;
+        return 1;
+    }
+
+    if (numThreads < 1) {
+        cout << "ERROR: number of threads must be at least 1" << endl;
+        return 1;
     }
 
-    // algorithm for independent sets technically has different name.
-    if (bComputeIndependentSet) {
-        name = name.replace(name.size()-3,2, "mis");
+    if (timeLimit < 0.0 || nodeLimit < 0) {
+        cout << "ERROR: time and node limits must not be negative" << endl;
+        return 1;
+    }
+
+    if (checkpointInterval <= 0.0) {
+        cout << "ERROR: checkpoint interval must be positive" << endl;
+        return 1;
+    }
+
+    if (kernelInputsInterval < 1) {
+        cout << "ERROR: kernel input interval must be at least 1" << endl;
+        return 1;
+    }
+
+    // algorithm for independent sets technically has different name, unless
+    // it was given by that name.
+    if (bComputeIndependentSet && !isIndependentSetAlgorithm(name)) {
+        if (name == "bitset-mcs" || name == "degeneracy-mcs") {
+            cout << "ERROR: " << name << " only computes cliques, --compute-independent-set is supported by mcq, mcr, static-order-mcs, mcs, and sparse-mcs" << endl;
+            return 1;
+        }
+        if (isValidAlgorithm(name)) name = name.replace(name.size()-3,2, "mis");
     }
 
     Algorithm *pAlgorithm(nullptr);
@@ -170,64 +249,201 @@ int main(int argc, char** argv)
     int n; // number of vertices
     int m; // 2x number of edges
 
-    vector<list<int>> adjacencyList;
-    if (inputFile.find(".graph") != string::npos) {
-        if (!bTableMode) cout << "Reading .graph file format. " << endl << flush;
-        adjacencyList = readInGraphAdjListEdgesPerLine(n, m, inputFile);
+    // every format is converted to CSR, binary CSR files are mapped directly.
+    // the format is chosen by --format, or else by the file's contents and extension.
+    string const graphFormat(format.empty() ? GraphReader::FormatForFile(inputFile) : format);
+    CSRGraph graph;
+    if (graphFormat == "csr") {
+        if (bPrintProgress) cout << "Reading binary CSR file format. " << endl << flush;
+        graph.Load(inputFile);
     } else {
-        if (!bTableMode) cout << "Reading .edges file format. " << endl << flush;
-        adjacencyList = readInGraphAdjList(n, m, inputFile);
+        int const numReaderThreads(max(1, static_cast<int>(thread::hardware_concurrency())));
+        chrono::steady_clock::time_point const startRead(chrono::steady_clock::now());
+        if (bPrintProgress) cout << "Reading " << graphFormat << " file format. " << endl << flush;
+        size_t const uBytesRead(GraphReader::Read(inputFile, graphFormat, graph, numReaderThreads));
+        double const readSeconds(chrono::duration<double>(chrono::steady_clock::now() - startRead).count());
+        if (!bQuiet) {
+            double const megabytes(uBytesRead/(1024.0*1024.0));
+            cout << "Parsed " << megabytes << " MB with " << numReaderThreads << " threads in " << readSeconds << " seconds (" << (readSeconds > 0.0 ? megabytes/readSeconds : 0.0) << " MB/s)" << endl << flush;
+        }
     }
 
-    bool const bComputeAdjacencyMatrix(adjacencyList.size() < 20000);
-    bool const bShouldComputeAdjacencyMatrix(name == "mcq" || name == "mcr" || name == "static-order-mcs" || name == "mcs" || name == "misq" || name == "misr" || name == "static-order-miss" || name == "miss");
+    n = graph.NumVertices();
+    m = graph.NumEntries();
+
+    bool const bIsKnownAlgorithm(name == "mcq" || name == "mcr" || name == "static-order-mcs" || name == "mcs" || name == "bitset-mcs" || name == "sparse-mcs" || name == "degeneracy-mcs" || name == "misq" || name == "misr" || name == "static-order-miss" || name == "miss" || name == "sparse-miss");
 
+    // bitset-mcs builds its bitsets straight from the CSR arrays, and
+    // sparse-mcs, degeneracy-mcs, and sparse-miss only need adjacency arrays.
+    bool const bUsesAdjacencyArray(name == "sparse-mcs" || name == "degeneracy-mcs" || name == "sparse-miss");
+    bool const bShouldComputeAdjacencyMatrix(bIsKnownAlgorithm && name != "bitset-mcs" && !bUsesAdjacencyArray);
     bool const addDiagonals(name == "misq" || name == "misr" || name == "static-order-miss" || name == "miss");
 
-    if (bShouldComputeAdjacencyMatrix && !bComputeAdjacencyMatrix) {
-        cout << "ERROR: unable to compute adjacencyMatrix, since the graph is too large: " << adjacencyList.size() << endl << flush;
+    // with --reduce, the matrix is built for the kernel, once it is known.
+    bool const bReduceGraph(bReduce && addDiagonals);
+    bool const bComputeAdjacencyMatrix(bShouldComputeAdjacencyMatrix && !bReduceGraph && n < 20000);
+
+    if (bShouldComputeAdjacencyMatrix && !bReduceGraph && !bComputeAdjacencyMatrix) {
+        cout << "ERROR: unable to compute adjacencyMatrix, since the graph is too large: " << n << endl << flush;
         exit(1);
     }
 
     vector<vector<char>> vAdjacencyMatrix;
 
     if (bComputeAdjacencyMatrix) {
-        vAdjacencyMatrix.resize(n);
+        graph.BuildAdjacencyMatrix(vAdjacencyMatrix, addDiagonals);
+    }
 
-        for(int i=0; i<n; i++) {
-            vAdjacencyMatrix[i].resize(n);
-            for(int const neighbor : adjacencyList[i]) {
-                vAdjacencyMatrix[i][neighbor] = 1; 
-            }
-            if (addDiagonals) {
-                vAdjacencyMatrix[i][i] = 1;
-            }
-        }
+    vector<vector<int>> adjacencyArray;
+
+    if (bUsesAdjacencyArray || bReduceGraph) {
+        graph.BuildAdjacencyArray(adjacencyArray);
     }
 
-    adjacencyList.clear(); // does this free up memory? probably some...
-
-    if (name == "mcq") {
-        pAlgorithm = new MCQ(vAdjacencyMatrix);
-    } else if (name == "mcr") {
-        pAlgorithm = new MCR(vAdjacencyMatrix);
-    } else if (name == "static-order-mcs") {
-        pAlgorithm = new StaticOrderMCS(vAdjacencyMatrix);
-    } else if (name == "mcs") {
-        pAlgorithm = new MCS(vAdjacencyMatrix);
-    } else if (name == "misq") {
-        pAlgorithm = new MISQ(vAdjacencyMatrix);
-    } else if (name == "misr") {
-        pAlgorithm = new MISR(vAdjacencyMatrix);
-    } else if (name == "static-order-miss") {
-        pAlgorithm = new StaticOrderMISS(vAdjacencyMatrix);
-    } else if (name == "miss") {
-        pAlgorithm = new MISS(vAdjacencyMatrix);
-    } else {
+    if (coloring != "greedy" && name != "mcq" && name != "mcr" && name != "static-order-mcs" && name != "mcs") {
+        cout << "ERROR: " << coloring << " coloring is only supported by mcq, mcr, static-order-mcs, and mcs" << endl;
+        return 1;
+    }
+
+    // one per worker, as each keeps its own propagation state.
+    list<MaxSatBound> maxSatBounds;
+
+    // parallel search runs one copy of the algorithm per thread.
+    auto createAlgorithm = [&name, &coloring, &vAdjacencyMatrix, &adjacencyArray, &graph, bMaxSatBound, addDiagonals, &maxSatBounds]() -> MaxSubgraphAlgorithm* {
+        MCQ *pMCQ(nullptr); // set for algorithms with a configurable coloring
+        MaxSubgraphAlgorithm *pMaxSubgraphAlgorithm(nullptr);
+        if (name == "mcq") {
+            pMaxSubgraphAlgorithm = pMCQ = new MCQ(vAdjacencyMatrix);
+        } else if (name == "mcr") {
+            pMaxSubgraphAlgorithm = pMCQ = new MCR(vAdjacencyMatrix);
+        } else if (name == "static-order-mcs") {
+            pMaxSubgraphAlgorithm = pMCQ = new StaticOrderMCS(vAdjacencyMatrix);
+        } else if (name == "mcs") {
+            pMaxSubgraphAlgorithm = pMCQ = new MCS(vAdjacencyMatrix);
+        } else if (name == "bitset-mcs") {
+            pMaxSubgraphAlgorithm = new BitSetMCS(graph);
+        } else if (name == "sparse-mcs") {
+            pMaxSubgraphAlgorithm = new SparseMCS(adjacencyArray);
+        } else if (name == "misq") {
+            pMaxSubgraphAlgorithm = new MISQ(vAdjacencyMatrix);
+        } else if (name == "misr") {
+            pMaxSubgraphAlgorithm = new MISR(vAdjacencyMatrix);
+        } else if (name == "static-order-miss") {
+            pMaxSubgraphAlgorithm = new StaticOrderMISS(vAdjacencyMatrix);
+        } else if (name == "miss") {
+            pMaxSubgraphAlgorithm = new MISS(vAdjacencyMatrix);
+        }
+
+        if (pMCQ != nullptr && coloring == "bitset") {
+            pMCQ->SetBitSetColoring(true);
+        }
+
+        if (pMCQ != nullptr && coloring == "incremental") {
+            pMCQ->SetIncrementalColoring(true);
+        }
+
+        if (bMaxSatBound) {
+            maxSatBounds.emplace_back(vAdjacencyMatrix, addDiagonals /* independent set algorithms */);
+            pMaxSubgraphAlgorithm->SetMaxSatBound(&maxSatBounds.back());
+        }
+
+        return pMaxSubgraphAlgorithm;
+    };
+
+    if (!bIsKnownAlgorithm) {
         cout << "ERROR: unrecognized algorithm name " << name << endl;
         return 1;
     }
 
+    if (bWorkStealing && name == "bitset-mcs") {
+        cout << "NOTE: bitset-mcs does not support work stealing, only the root branches are split between threads." << endl;
+    }
+
+    // sparse-miss always reduces the graph.
+    if (bReduce && !bReduceGraph && name != "sparse-miss") {
+        cout << "ERROR: reductions are only supported by misq, misr, static-order-miss, and miss" << endl;
+        return 1;
+    }
+
+    // degeneracy-mcs, sparse-miss, and --reduce run a search per subproblem.
+    bool const bSolvesSubproblems(name == "degeneracy-mcs" || name == "sparse-miss" || bReduceGraph);
+
+    if (name == "sparse-miss" && numThreads > 1) {
+        cout << "ERROR: sparse-miss only runs with one thread" << endl;
+        return 1;
+    }
+
+    // only the serial search on search frames can be saved and resumed.
+    bool const bCheckpoint(!checkpointFile.empty());
+    if (bCheckpoint && (numThreads > 1 || name == "bitset-mcs" || bSolvesSubproblems)) {
+        cout << "ERROR: checkpoints are only supported with one thread, and not by bitset-mcs, degeneracy-mcs, or sparse-miss, or with --reduce" << endl;
+        return 1;
+    }
+
+    if (!statisticsFile.empty() && (name == "bitset-mcs" || bSolvesSubproblems)) {
+        cout << "ERROR: search statistics are not supported by bitset-mcs, degeneracy-mcs, or sparse-miss, or with --reduce" << endl;
+        return 1;
+    }
+
+    if (!kernelInputsFile.empty() && (numThreads > 1 || name == "bitset-mcs" || bSolvesSubproblems)) {
+        cout << "ERROR: kernel inputs can only be dumped with one thread, and not by bitset-mcs, degeneracy-mcs, or sparse-miss, or with --reduce" << endl;
+        return 1;
+    }
+
+    // the bound tests adjacency in the matrix.
+    if (bMaxSatBound && !bShouldComputeAdjacencyMatrix) {
+        cout << "ERROR: the MaxSAT bound is only supported by mcq, mcr, static-order-mcs, mcs, and their independent set equivalents" << endl;
+        return 1;
+    }
+
+    // the counters only count the thread that opened them.
+    if (bPerfCounters && (numThreads > 1 || bSolvesSubproblems)) {
+        cout << "ERROR: perf counters are only supported with one thread, and not by degeneracy-mcs or sparse-miss, or with --reduce" << endl;
+        return 1;
+    }
+
+    SearchCheckpoint checkpoint(checkpointFile, checkpointInterval, name, n, m);
+    KernelInputs kernelInputs(kernelInputsInterval, 1 << 24 /* vertices, 64 MB */);
+
+    auto createSearch = [&createAlgorithm, numThreads, bWorkStealing, bCheckpoint, &checkpoint, &resumeFile, &kernelInputsFile, &kernelInputs]() -> Algorithm* {
+        if (numThreads > 1) {
+            return new ParallelMaxSubgraphAlgorithm(createAlgorithm, numThreads, bWorkStealing);
+        }
+
+        MaxSubgraphAlgorithm *pMaxSubgraphAlgorithm(createAlgorithm());
+        if (bCheckpoint) pMaxSubgraphAlgorithm->SetCheckpoint(&checkpoint, resumeFile);
+        if (!kernelInputsFile.empty()) pMaxSubgraphAlgorithm->SetKernelInputs(&kernelInputs);
+        return pMaxSubgraphAlgorithm;
+    };
+
+    if (name == "degeneracy-mcs") {
+        pAlgorithm = new DegeneracyMCS(adjacencyArray, numThreads);
+    } else if (name == "sparse-miss") {
+        pAlgorithm = new ComponentMISS(name, adjacencyArray, [](vector<vector<int>> const &vComponent) -> Algorithm* {
+            return new SparseMISS(vComponent);
+        });
+    } else if (bReduceGraph) {
+        pAlgorithm = new ComponentMISS(name, adjacencyArray, [&vAdjacencyMatrix, &createSearch](vector<vector<int>> const &vComponent) -> Algorithm* {
+            if (vComponent.size() >= 20000) {
+                cout << "ERROR: unable to compute adjacencyMatrix, since a component of the kernel is too large: " << vComponent.size() << endl << flush;
+                exit(1);
+            }
+
+            // with diagonals, as for the independent set algorithms on the graph.
+            vAdjacencyMatrix.assign(vComponent.size(), vector<char>(vComponent.size(), 0));
+            for (size_t vertex = 0; vertex < vComponent.size(); ++vertex) {
+                vAdjacencyMatrix[vertex][vertex] = 1;
+                for (int const neighbor : vComponent[vertex]) {
+                    vAdjacencyMatrix[vertex][neighbor] = 1;
+                }
+            }
+
+            return createSearch();
+        });
+    } else {
+        pAlgorithm = createSearch();
+    }
+
     auto verifyCliqueMatrix = [&vAdjacencyMatrix](list<int> const &clique) {
         bool const isIS = CliqueTools::IsClique(vAdjacencyMatrix, clique, true /* verbose */);
         if (!isIS) {
@@ -249,9 +465,7 @@ int main(int argc, char** argv)
 ////    pAlgorithm->AddCallBack(printCliqueSize);
 ////    pAlgorithm->AddCallBack(printClique);
 
-    if (!bComputeAdjacencyMatrix) {
-        assert(0);
-    } else {
+    if (bComputeAdjacencyMatrix) {
 ////        pAlgorithm->AddCallBack(verifyCliqueMatrix);
 ////        pAlgorithm->AddCallBack(verifyIndependentSetMatrix);
     }
@@ -261,15 +475,65 @@ int main(int argc, char** argv)
 
     pAlgorithm->SetQuiet(bQuiet);
 
-    RunAndPrintStats(pAlgorithm, cliques, bTableMode);
+    SearchLimits searchLimits(timeLimit, static_cast<size_t>(nodeLimit));
+    if (timeLimit > 0.0 || nodeLimit > 0) {
+        pAlgorithm->SetSearchLimits(&searchLimits);
+    }
+
+    SearchStatistics searchStatistics;
+    if (!statisticsFile.empty()) {
+        pAlgorithm->SetSearchStatistics(&searchStatistics);
+    }
+
+    PerfProfile perfProfile;
+    if (bPerfCounters) {
+        perfProfile.Activate();
+    }
+
+    searchLimits.Start();
+    if (bRecordMode) {
+        if (bPrintHeader) PrintRecordHeader(outputFormat);
+        RunAndPrintRecord(pAlgorithm, cliques, outputFormat, inputFile, n, m/2);
+    } else {
+        RunAndPrintStats(pAlgorithm, cliques, bTableMode);
+    }
+
+    if (!statisticsFile.empty()) {
+        searchStatistics.WriteJson(statisticsFile, pAlgorithm->GetName());
+    }
+
+    if (bPerfCounters) {
+        perfProfile.Print(stderr);
+    }
+
+    if (bMaxSatBound) {
+        size_t uNumTests(0), uNumPrunes(0);
+        for (MaxSatBound const &maxSatBound : maxSatBounds) {
+            uNumTests  += maxSatBound.GetNumTests();
+            uNumPrunes += maxSatBound.GetNumPrunes();
+        }
+        cerr << "MaxSAT Bound       : " << uNumPrunes << " of " << uNumTests << " children pruned" << endl;
+    }
+
+    if (!kernelInputsFile.empty()) {
+        vector<vector<int>> vGraph;
+        graph.BuildAdjacencyArray(vGraph);
+        kernelInputs.Write(kernelInputsFile, vGraph, addDiagonals /* independent set algorithms */);
+        if (bPrintProgress) cout << "Wrote " << kernelInputs.GetSamples().size() << " kernel input samples to " << kernelInputsFile << endl;
+    }
 
 ////    cout << "Last clique has size: " << cliques.back().size() << endl << flush;
 
     cliques.clear();
 
     vAdjacencyMatrix.clear();
+    adjacencyArray.clear();
     delete pAlgorithm; pAlgorithm = nullptr;
 
+    if (!bQuiet) {
+        cerr << "Peak Memory        : " << PeakResidentSetSizeInKB()/1024.0 << " MB" << endl;
+    }
+
 #ifdef DEBUG_MESSAGE
     PrintDebugWarning();
 #endif
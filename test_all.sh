@@ -16,5 +16,5 @@ for i in data/*
 do
 	data_set_name=`echo $i | sed -e "s%^data/%%g" | sed -e "s/\.graph$//g"`
     echo -n "$data_set_name		"
-    bin/open-mcs --algorithm=mcs --input-file=$i 2>&1 | grep "mcs:" | sed -e 's/mcs: Found maximum clique of size \(.*\) in \(.*\) seconds/\1		\2s/g'
+    bin/open-mcs --algorithm=mcs --input-file=$i --output-format=csv | awk -F, '{ printf "%s\t\t%ss\n", $6, $9 }'
 done
@@ -18,5 +18,5 @@ for i in $data_set_names
 do
 	data_set_name=`echo $i | sed -e "s%^data/%%g" | sed -e "s/\.graph$//g"`
     echo -n "$data_set_name		"
-    bin/open-mcs --algorithm=mcs --input-file=data/$i.graph 2>&1 | grep "mcs:" | sed -e 's/mcs: Found maximum clique of size \(.*\) in \(.*\) seconds/\1		\2s/g'
+    bin/open-mcs --algorithm=mcs --input-file=data/$i.graph --output-format=csv | awk -F, '{ printf "%s\t\t%ss\n", $6, $9 }'
 done
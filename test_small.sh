@@ -0,0 +1,162 @@
+#! /bin/bash
+
+# Runs every algorithm on tiny graphs, whose subproblems are too small for
+# the dense searches, and checks the size of the solution.
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+cd $DIR
+
+make -j4 > /dev/null 2>&1 || exit 1
+
+TMP_DIR=`mktemp -d`
+trap "rm -rf $TMP_DIR" EXIT
+
+# METIS: "n m", then the 1-based neighbors of each vertex.
+printf '1 0\n\n' > $TMP_DIR/vertex.graph
+printf '2 1\n2\n1\n' > $TMP_DIR/edge.graph
+printf '3 2\n2\n1 3\n2\n' > $TMP_DIR/path.graph
+printf '6 5\n2 3\n1 4 5\n1 6\n2\n2\n3\n' > $TMP_DIR/tree.graph
+
+clique_algorithms="mcq mcr static-order-mcs mcs bitset-mcs sparse-mcs degeneracy-mcs"
+independent_set_algorithms="mcq mcr static-order-mcs mcs sparse-mcs"
+
+failures=0
+
+# check <algorithm> <graph> <expected size> [options]
+check() {
+    size=`bin/open-mcs --algorithm=$1 --input-file=$TMP_DIR/$2.graph ${@:4} 2>&1 > /dev/null | sed -n 's/.*Found maximum clique of size \([0-9-]*\).*/\1/p'`
+    if [ "$size" != "$3" ]; then
+        echo "FAILED: $1 ${@:4} on $2: expected $3, got '$size'"
+        failures=$((failures+1))
+    fi
+}
+
+for algorithm in $clique_algorithms
+do
+    for threads in 1 4
+    do
+        check $algorithm vertex 1 --threads=$threads
+        check $algorithm edge 2 --threads=$threads
+        check $algorithm path 2 --threads=$threads
+        check $algorithm tree 2 --threads=$threads
+    done
+done
+
+for algorithm in $independent_set_algorithms
+do
+    check $algorithm vertex 1 --compute-independent-set
+    check $algorithm edge 1 --compute-independent-set
+    check $algorithm path 2 --compute-independent-set
+    check $algorithm tree 4 --compute-independent-set
+done
+
+# the independent set names, with or without --compute-independent-set.
+for algorithm in misq misr static-order-miss miss sparse-miss
+do
+    for option in "" --compute-independent-set
+    do
+        check $algorithm edge 1 $option
+        check $algorithm tree 4 $option
+    done
+done
+
+for algorithm in bitset-mcs degeneracy-mcs
+do
+    if ! bin/open-mcs --algorithm=$algorithm --compute-independent-set --input-file=$TMP_DIR/edge.graph 2>&1 | grep -q "only computes cliques"; then
+        echo "FAILED: $algorithm accepted --compute-independent-set"
+        failures=$((failures+1))
+    fi
+done
+
+# random graphs, dense for cliques and sparse for independent sets, with
+# searches of a few hundred to a few thousand nodes.
+random_graph() {
+    awk -v p=$1 'BEGIN { srand(7); n = 90; m = 0
+        for (i = 1; i <= n; i++) for (j = i+1; j <= n; j++) if (rand() < p) { a[i] = a[i] " " j; a[j] = a[j] " " i; m++ }
+        print n, m; for (i = 1; i <= n; i++) print substr(a[i], 2) }'
+}
+random_graph 0.7 > $TMP_DIR/dense.graph
+random_graph 0.3 > $TMP_DIR/sparse.graph
+
+# check_resume <algorithm> <graph>: stops the search every 100 nodes and
+# resumes it from the checkpoint, until it is done, and compares the size and
+# node count with an uninterrupted search.
+check_resume() {
+    expected=`bin/open-mcs --algorithm=$1 --input-file=$TMP_DIR/$2.graph --output-format=csv 2> /dev/null | cut -d, -f6,12`
+    rm -f $TMP_DIR/checkpoint
+    for run in `seq 100`
+    do
+        record=`bin/open-mcs --algorithm=$1 --input-file=$TMP_DIR/$2.graph --output-format=csv --node-limit=100 --resume=$TMP_DIR/checkpoint 2> /dev/null`
+        if [ "`echo $record | cut -d, -f5`" != "node-limit" ]; then break; fi
+    done
+    result=`echo $record | cut -d, -f6,12`
+    if [ $run -lt 3 ] || [ "$result" != "$expected" ]; then
+        echo "FAILED: $1 resumed $run times on $2: expected size,nodes $expected, got '$result'"
+        failures=$((failures+1))
+    fi
+}
+
+for algorithm in mcq mcr static-order-mcs mcs
+do
+    check_resume $algorithm dense
+done
+for algorithm in misq misr static-order-miss miss
+do
+    check_resume $algorithm sparse
+done
+
+# a checkpoint whose header claims 2^61 entries of state is truncated.
+bin/open-mcs --algorithm=mcs --input-file=$TMP_DIR/dense.graph --node-limit=100 --checkpoint=$TMP_DIR/checkpoint > /dev/null 2>&1
+printf '\x00\x00\x00\x00\x00\x00\x00\x20' | dd of=$TMP_DIR/checkpoint bs=1 seek=56 conv=notrunc 2> /dev/null
+if ! bin/open-mcs --algorithm=mcs --input-file=$TMP_DIR/dense.graph --resume=$TMP_DIR/checkpoint 2>&1 | grep -q "is truncated"; then
+    echo "FAILED: mcs resumed from a checkpoint with a corrupt state size"
+    failures=$((failures+1))
+fi
+
+# graphs on which --reduce applies: a 5-cycle is folded, K_{3,2} with an
+# edge between two of its three vertices has degree 3 twins, an octahedron
+# with a vertex on one face dominates the face's vertices, and a bipartite
+# graph of four vertices and five with more neighbors is a crown.
+printf '5 5\n2 5\n1 3\n2 4\n3 5\n1 4\n' > $TMP_DIR/fold.graph
+printf '5 7\n3 4 5\n3 4 5\n1 2 4\n1 2 3\n1 2\n' > $TMP_DIR/twins.graph
+printf '7 15\n3 4 5 6 7\n3 4 5 6\n1 2 5 6 7\n1 2 5 6\n1 2 3 4 7\n1 2 3 4\n1 3 5\n' > $TMP_DIR/dominated.graph
+printf '9 16\n5 6 7 9\n5 6 8 9\n5 7 8 9\n6 7 8 9\n1 2 3\n1 2 4\n1 3 4\n2 3 4\n1 2 3 4\n' > $TMP_DIR/crown.graph
+
+# check_reduce <graph> <reduction>: the reduction is applied, the independent
+# set is as large as the one miss finds without reductions, and independent.
+check_reduce() {
+    expected=`bin/open-mcs --algorithm=miss --input-file=$TMP_DIR/$1.graph --output-format=csv 2> /dev/null | cut -d, -f6`
+    for algorithm in misq misr static-order-miss miss sparse-miss
+    do
+        record=`bin/open-mcs --algorithm=$algorithm --reduce --verbose --input-file=$TMP_DIR/$1.graph --output-format=csv 2> $TMP_DIR/verbose`
+        size=`echo $record | cut -d, -f6`
+        vertices=`echo $record | cut -d, -f8`
+        if [ "$size" != "$expected" ]; then
+            echo "FAILED: $algorithm --reduce on $1: expected $expected, got '$size'"
+            failures=$((failures+1))
+        fi
+        if ! grep -q "^$2 *: [1-9]" $TMP_DIR/verbose; then
+            echo "FAILED: $algorithm --reduce on $1: no $2"
+            failures=$((failures+1))
+        fi
+        # the vertices are numbered from 0, the lines of the neighbors from 2.
+        edges=`awk -v set="$vertices" 'BEGIN { k = split(set, s, " "); for (i = 1; i <= k; i++) in_set[s[i]] = 1 }
+            NR > 1 && (NR-2) in in_set { for (i = 1; i <= NF; i++) if (($i-1) in in_set) edges++ }
+            END { print edges+0 }' $TMP_DIR/$1.graph`
+        if [ "$edges" != "0" ] || [ "`echo $vertices | wc -w`" != "$size" ]; then
+            echo "FAILED: $algorithm --reduce on $1: '$vertices' is not an independent set of size $size"
+            failures=$((failures+1))
+        fi
+    done
+}
+
+check_reduce fold "Degree 2 Reductions"
+check_reduce twins "Twin Reductions"
+check_reduce dominated "Dominated Vertices"
+check_reduce crown "LP Reduced Vertices"
+
+if [ $failures -ne 0 ]; then
+    echo "$failures failed"
+    exit 1
+fi
+echo "passed"